@@ -0,0 +1,59 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_BENCHMARK_HPP
+#define STL2_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace bench {
+	// Runs setup() then f() reps times, returning the fastest run of f in
+	// milliseconds.
+	template<class Setup, class F>
+	double time_ms(int reps, Setup setup, F f) {
+		using clock = std::chrono::steady_clock;
+		double best = 1e300;
+		for (int i = 0; i < reps; ++i) {
+			setup();
+			auto start = clock::now();
+			f();
+			auto stop = clock::now();
+			best = std::min(best,
+				std::chrono::duration<double, std::milli>(stop - start).count());
+		}
+		return best;
+	}
+
+	// Defeats dead-store elimination of benchmark results.
+	template<class T>
+	void do_not_optimize(T const& t) {
+		asm volatile("" : : "g"(&t) : "memory");
+	}
+
+	inline void print_header(const char* first, std::vector<const char*> const& columns) {
+		std::printf("%-14s", first);
+		for (auto c : columns) {
+			std::printf(" %14s", c);
+		}
+		std::printf("\n");
+	}
+
+	inline void print_row(const char* name, std::vector<double> const& values) {
+		std::printf("%-14s", name);
+		for (auto v : values) {
+			std::printf(" %14.3f", v);
+		}
+		std::printf("\n");
+	}
+}
+
+#endif
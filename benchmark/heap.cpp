@@ -0,0 +1,115 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares the binary heap of std::push_heap and std::pop_heap with the
+// d-ary heaps of ext::push_heap<Arity> and ext::pop_heap<Arity>, used as a
+// priority queue of a given size.
+//
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <stl2/detail/algorithm/dary_heap.hpp>
+#include "benchmark.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	using key = std::uint64_t;
+
+	struct std_heap {
+		static void make(std::vector<key>& v) { std::make_heap(v.begin(), v.end()); }
+		static void push(std::vector<key>& v) { std::push_heap(v.begin(), v.end()); }
+		static void pop(std::vector<key>& v) { std::pop_heap(v.begin(), v.end()); }
+	};
+
+	template<std::ptrdiff_t Arity>
+	struct dary_heap {
+		static void make(std::vector<key>& v) { ranges::ext::make_heap<Arity>(v); }
+		static void push(std::vector<key>& v) { ranges::ext::push_heap<Arity>(v); }
+		static void pop(std::vector<key>& v) { ranges::ext::pop_heap<Arity>(v); }
+	};
+
+	// Builds a heap of the input, then pops it empty.
+	struct make_and_drain {
+		static constexpr const char* name = "make+drain";
+
+		template<class Heap>
+		static void run(std::vector<key>& v, const std::vector<key>&) {
+			Heap::make(v);
+			while (!v.empty()) {
+				Heap::pop(v);
+				v.pop_back();
+			}
+		}
+	};
+
+	// Pushes the input one element at a time, then pops it empty.
+	struct fill_and_drain {
+		static constexpr const char* name = "fill+drain";
+
+		template<class Heap>
+		static void run(std::vector<key>& v, const std::vector<key>& input) {
+			v.clear();
+			for (auto x : input) {
+				v.push_back(x);
+				Heap::push(v);
+			}
+			while (!v.empty()) {
+				Heap::pop(v);
+				v.pop_back();
+			}
+		}
+	};
+
+	// The "hold" model of a scheduler's queue: each step pops the top of a
+	// heap of the input and pushes it back with a lower priority.
+	struct hold {
+		static constexpr const char* name = "hold";
+
+		template<class Heap>
+		static void run(std::vector<key>& v, const std::vector<key>& input) {
+			Heap::make(v);
+			for (auto x : input) {
+				Heap::pop(v);
+				v.back() -= std::min(v.back(), x % 1024);
+				Heap::push(v);
+			}
+		}
+	};
+
+	template<class Workload>
+	void run(std::vector<key> const& input, std::vector<key>& work, int reps) {
+		auto time = [&](auto heap) {
+			using Heap = decltype(heap);
+			double const t = bench::time_ms(reps, [&] { work = input; }, [&] {
+				Workload::template run<Heap>(work, input);
+			});
+			bench::do_not_optimize(work);
+			return t;
+		};
+		bench::print_row(Workload::name, {time(std_heap{}), time(dary_heap<2>{}),
+			time(dary_heap<4>{}), time(dary_heap<8>{})});
+	}
+}
+
+int main(int argc, char** argv) {
+	std::size_t const n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+	int const reps = 3;
+	std::mt19937_64 gen{42};
+	std::vector<key> input(n), work;
+	for (auto& x : input) x = gen();
+
+	std::printf("heaps of %zu uint64_t, best of %d (ms)\n", n, reps);
+	bench::print_header("workload", {"std binary", "ext 2-ary", "ext 4-ary", "ext 8-ary"});
+	run<make_and_drain>(input, work, reps);
+	run<fill_and_drain>(input, work, reps);
+	run<hold>(input, work, reps);
+}
@@ -0,0 +1,79 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares __stl2::sort with std::sort - a classic median-of-3 introsort,
+// like the engine __stl2::sort used before pdqsort - on common input
+// patterns.
+//
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <stl2/detail/algorithm/sort.hpp>
+#include "benchmark.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	using input_fn = void(*)(std::vector<std::uint64_t>&, std::mt19937_64&);
+
+	struct pattern {
+		const char* name;
+		input_fn fill;
+	};
+
+	const pattern patterns[] = {
+		{"random", [](auto& v, auto& gen) {
+			for (auto& x : v) x = gen();
+		}},
+		{"sorted", [](auto& v, auto&) {
+			for (std::size_t i = 0; i < v.size(); ++i) v[i] = i;
+		}},
+		{"reversed", [](auto& v, auto&) {
+			for (std::size_t i = 0; i < v.size(); ++i) v[i] = v.size() - i;
+		}},
+		{"organ_pipe", [](auto& v, auto&) {
+			auto const n = v.size();
+			for (std::size_t i = 0; i < n; ++i) v[i] = i < n / 2 ? i : n - i;
+		}},
+		{"sawtooth", [](auto& v, auto&) {
+			for (std::size_t i = 0; i < v.size(); ++i) v[i] = i % 1024;
+		}},
+		{"few_unique", [](auto& v, auto& gen) {
+			for (auto& x : v) x = gen() % 16;
+		}},
+		{"sorted_tail", [](auto& v, auto& gen) {
+			for (std::size_t i = 0; i < v.size(); ++i) v[i] = i;
+			for (std::size_t i = 0; i < v.size() / 1000; ++i) v[v.size() - 1 - i] = gen();
+		}},
+	};
+}
+
+int main(int argc, char** argv) {
+	std::size_t const n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+	int const reps = 5;
+	std::mt19937_64 gen{42};
+	std::vector<std::uint64_t> input(n), work(n);
+
+	std::printf("sorting %zu uint64_t, best of %d (ms)\n", n, reps);
+	bench::print_header("pattern", {"std::sort", "ranges::sort", "speedup"});
+	for (auto const& p : patterns) {
+		p.fill(input, gen);
+		auto setup = [&] { work = input; };
+		double const introsort = bench::time_ms(reps, setup, [&] {
+			std::sort(work.begin(), work.end());
+		});
+		double const pdqsort = bench::time_ms(reps, setup, [&] {
+			ranges::sort(work);
+		});
+		bench::do_not_optimize(work);
+		bench::print_row(p.name, {introsort, pdqsort, introsort / pdqsort});
+	}
+}
@@ -0,0 +1,141 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares copy and fill of a buffer larger than the last-level cache with
+// ext::stream_copy and ext::stream_fill, by their bandwidth and by how fast
+// random lookups in a table that fits in the cache run after each of them:
+// regular stores evict the table, non-temporal stores leave it.
+//
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/fill.hpp>
+#include <stl2/detail/algorithm/stream_copy.hpp>
+#include <stl2/detail/algorithm/stream_fill.hpp>
+#include "benchmark.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	using key = std::uint32_t;
+
+	// Dependent random lookups in the table, so that each one waits on
+	// the memory it reads.
+	key lookups(const std::vector<key>& table, int n) {
+		key k = 0;
+		for (int i = 0; i < n; ++i) {
+			k = table[k];
+		}
+		return k;
+	}
+
+	struct copy {
+		static constexpr const char* name = "copy";
+		static void run(std::vector<char>& dst, const std::vector<char>& src) {
+			ranges::copy(src, dst.begin());
+		}
+	};
+	struct stream_copy {
+		static constexpr const char* name = "stream_copy";
+		static void run(std::vector<char>& dst, const std::vector<char>& src) {
+			ranges::ext::stream_copy(src, dst.begin());
+		}
+	};
+	struct fill {
+		static constexpr const char* name = "fill";
+		static void run(std::vector<char>& dst, const std::vector<char>&) {
+			ranges::fill(dst, char{1});
+		}
+	};
+	struct stream_fill {
+		static constexpr const char* name = "stream_fill";
+		static void run(std::vector<char>& dst, const std::vector<char>&) {
+			ranges::ext::stream_fill(dst, char{1});
+		}
+	};
+
+	struct buffers {
+		std::vector<char> src, dst;
+		std::vector<key> table;
+		int n;
+		int reps;
+	};
+
+	// The bandwidth of the store, and the time of the lookups after it.
+	template<class Store>
+	void interleaved(buffers& b) {
+		double store = 1e300, after = 1e300;
+		for (int i = 0; i < b.reps; ++i) {
+			store = std::min(store, bench::time_ms(1, [] {}, [&] { Store::run(b.dst, b.src); }));
+			after = std::min(after, bench::time_ms(1, [] {}, [&] {
+				bench::do_not_optimize(lookups(b.table, b.n));
+			}));
+		}
+		bench::do_not_optimize(b.dst);
+		bench::print_row(Store::name, {b.dst.size() / store / 1e6, after});
+	}
+
+	// The time of the lookups while another thread stores over and over.
+	template<class Store>
+	void concurrent(buffers& b) {
+		std::atomic<bool> done{false};
+		std::thread t{[&] {
+			while (!done.load(std::memory_order_relaxed)) {
+				Store::run(b.dst, b.src);
+			}
+		}};
+		const double t_lookups = bench::time_ms(b.reps, [] {}, [&] {
+			bench::do_not_optimize(lookups(b.table, b.n));
+		});
+		done = true;
+		t.join();
+		bench::print_row(Store::name, {t_lookups});
+	}
+}
+
+int main(int argc, char** argv) {
+	const std::size_t mib = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 512;
+	const std::size_t table_mib = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+	const std::size_t entries = (table_mib << 20) / sizeof(key);
+	buffers b{std::vector<char>(mib << 20, 'x'), std::vector<char>(mib << 20),
+		std::vector<key>(entries), static_cast<int>(entries), 5};
+
+	// A single cycle through the table, in random order
+	std::vector<key> order(b.table.size());
+	for (std::size_t i = 0; i < order.size(); ++i) order[i] = static_cast<key>(i);
+	std::shuffle(order.begin(), order.end(), std::mt19937{42});
+	for (std::size_t i = 0; i < order.size(); ++i) {
+		b.table[order[i]] = order[(i + 1) % order.size()];
+	}
+
+	const double warm = bench::time_ms(b.reps, [] {}, [&] {
+		bench::do_not_optimize(lookups(b.table, b.n));
+	});
+	std::printf("stores to %zu MiB, %d lookups in %zu MiB, best of %d\n",
+		mib, b.n, table_mib, b.reps);
+	std::printf("lookups alone: %.3f ms\n", warm);
+	bench::print_header("store", {"GB/s", "lookups (ms)"});
+	interleaved<copy>(b);
+	interleaved<stream_copy>(b);
+	interleaved<fill>(b);
+	interleaved<stream_fill>(b);
+
+	if (std::thread::hardware_concurrency() > 1) {
+		std::printf("\nlookups during stores on another thread\n");
+		bench::print_header("store", {"lookups (ms)"});
+		concurrent<copy>(b);
+		concurrent<stream_copy>(b);
+		concurrent<fill>(b);
+		concurrent<stream_fill>(b);
+	}
+}
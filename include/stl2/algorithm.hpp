@@ -18,6 +18,7 @@
 #include <stl2/detail/algorithm/adjacent_find.hpp>
 #include <stl2/detail/algorithm/all_of.hpp>
 #include <stl2/detail/algorithm/any_of.hpp>
+#include <stl2/detail/algorithm/apply_permutation.hpp>
 #include <stl2/detail/algorithm/binary_search.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/copy_backward.hpp>
@@ -25,6 +26,7 @@
 #include <stl2/detail/algorithm/copy_n.hpp>
 #include <stl2/detail/algorithm/count.hpp>
 #include <stl2/detail/algorithm/count_if.hpp>
+#include <stl2/detail/algorithm/dary_heap.hpp>
 #include <stl2/detail/algorithm/equal.hpp>
 #include <stl2/detail/algorithm/equal_range.hpp>
 #include <stl2/detail/algorithm/fill.hpp>
@@ -51,6 +53,7 @@
 #include <stl2/detail/algorithm/max.hpp>
 #include <stl2/detail/algorithm/max_element.hpp>
 #include <stl2/detail/algorithm/merge.hpp>
+#include <stl2/detail/algorithm/merge_k.hpp>
 #include <stl2/detail/algorithm/min.hpp>
 #include <stl2/detail/algorithm/min_element.hpp>
 #include <stl2/detail/algorithm/minmax.hpp>
@@ -61,6 +64,7 @@
 #include <stl2/detail/algorithm/next_permutation.hpp>
 #include <stl2/detail/algorithm/none_of.hpp>
 #include <stl2/detail/algorithm/nth_element.hpp>
+#include <stl2/detail/algorithm/nth_elements.hpp>
 #include <stl2/detail/algorithm/partial_sort.hpp>
 #include <stl2/detail/algorithm/partial_sort_copy.hpp>
 #include <stl2/detail/algorithm/partition.hpp>
@@ -69,6 +73,7 @@
 #include <stl2/detail/algorithm/pop_heap.hpp>
 #include <stl2/detail/algorithm/prev_permutation.hpp>
 #include <stl2/detail/algorithm/push_heap.hpp>
+#include <stl2/detail/algorithm/radix_sort.hpp>
 #include <stl2/detail/algorithm/remove.hpp>
 #include <stl2/detail/algorithm/remove_copy.hpp>
 #include <stl2/detail/algorithm/remove_copy_if.hpp>
@@ -83,16 +88,23 @@
 #include <stl2/detail/algorithm/rotate_copy.hpp>
 #include <stl2/detail/algorithm/search.hpp>
 #include <stl2/detail/algorithm/search_n.hpp>
+#include <stl2/detail/algorithm/searcher.hpp>
 #include <stl2/detail/algorithm/set_difference.hpp>
 #include <stl2/detail/algorithm/set_intersection.hpp>
 #include <stl2/detail/algorithm/set_symmetric_difference.hpp>
 #include <stl2/detail/algorithm/set_union.hpp>
 #include <stl2/detail/algorithm/shuffle.hpp>
 #include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/sort_by_cached_key.hpp>
 #include <stl2/detail/algorithm/sort_heap.hpp>
+#include <stl2/detail/algorithm/sort_indices.hpp>
+#include <stl2/detail/algorithm/sort_small.hpp>
 #include <stl2/detail/algorithm/stable_partition.hpp>
 #include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/algorithm/stream_copy.hpp>
+#include <stl2/detail/algorithm/stream_fill.hpp>
 #include <stl2/detail/algorithm/swap_ranges.hpp>
+#include <stl2/detail/algorithm/top_k.hpp>
 #include <stl2/detail/algorithm/transform.hpp>
 #include <stl2/detail/algorithm/unique.hpp>
 #include <stl2/detail/algorithm/unique_copy.hpp>
@@ -0,0 +1,91 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_APPLY_PERMUTATION_HPP
+#define STL2_DETAIL_ALGORITHM_APPLY_PERMUTATION_HPP
+
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// apply_permutation [Extension]
+//
+// Rearranges [first, last) so that the element at position i is the one
+// previously at position perm[i], as computed by sort_indices. Each cycle
+// of the permutation costs one move per element plus two, and perm is
+// left unchanged so that it can be applied to several ranges in turn.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Permutes [first, first + n) so that the element at position i is
+		// the one previously at position source(i). source is called once
+		// for each position; thereafter, it must return the position itself.
+		template<RandomAccessIterator I, class Source>
+		requires Permutable<I>
+		void permute_by_gather(I first, const iter_difference_t<I> n, Source source)
+		{
+			using D = iter_difference_t<I>;
+			for (D i = 0; i < n; ++i) {
+				D k = source(i);
+				if (k == i) {
+					continue;
+				}
+				iter_value_t<I> tmp = iter_move(first + i);
+				D j = i;
+				do {
+					*(first + j) = iter_move(first + k);
+					j = k;
+					k = source(j);
+				} while (k != i);
+				*(first + j) = std::move(tmp);
+			}
+		}
+	}
+
+	namespace ext {
+		struct __apply_permutation_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, RandomAccessRange P>
+			requires Permutable<I> && Integral<iter_value_t<iterator_t<P>>>
+			I operator()(I first, S sent, P&& perm) const
+			{
+				using D = iter_difference_t<I>;
+				auto last = next(first, std::move(sent));
+				const auto n = D(last - first);
+				STL2_EXPECT(distance(perm) == n);
+				auto p = begin(perm);
+				std::vector<bool> done(static_cast<std::size_t>(n));
+				detail::permute_by_gather(first, n, [&](D j) {
+					if (done[j]) {
+						return j;
+					}
+					done[j] = true;
+					const auto k = D(p[j]);
+					STL2_EXPECT(0 <= k && k < n);
+					return k;
+				});
+				return last;
+			}
+
+			template<RandomAccessRange R, RandomAccessRange P>
+			requires Permutable<iterator_t<R>> && Integral<iter_value_t<iterator_t<P>>>
+			safe_iterator_t<R> operator()(R&& r, P&& perm) const
+			{
+				return (*this)(begin(r), end(r), std::forward<P>(perm));
+			}
+		};
+
+		inline constexpr __apply_permutation_fn apply_permutation {};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,180 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_BRANCHLESS_MERGE_HPP
+#define STL2_DETAIL_ALGORITHM_BRANCHLESS_MERGE_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/min.hpp>
+#include <stl2/detail/algorithm/pdq_partition.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Branch-free merge of small elements [Implementation detail]
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// The elements are cheap enough to copy, and their keys to compare,
+		// that a merge is best done by selecting each output element with
+		// conditional moves: on random keys, the branch of the usual merge
+		// is mispredicted about half of the time.
+		template<class I1, class I2, class O, class Comp, class Proj1, class Proj2>
+		META_CONCEPT __branchless_mergeable =
+			RandomAccessIterator<I1> && RandomAccessIterator<I2> &&
+			Same<iter_value_t<I1>, iter_value_t<I2>> &&
+			std::is_trivially_copyable_v<iter_value_t<I1>> &&
+			sizeof(iter_value_t<I1>) <= 2 * sizeof(void*) &&
+			Writable<O, iter_value_t<I1>> &&
+			__builtin_order<Comp> &&
+			std::is_arithmetic_v<__uncvref<indirect_result_t<Proj1&, I1>>> &&
+			std::is_arithmetic_v<__uncvref<indirect_result_t<Proj2&, I2>>>;
+
+		// The merge steps taken between checks for a block of one range
+		// that can be copied whole.
+		inline constexpr std::ptrdiff_t merge_block = 32;
+
+		// If the next merge_block elements of one of [first1 + i, ...) and
+		// [first2 + j, ...) go before the next element of the other, copies
+		// them to result and returns true. Both must have more elements
+		// than that left.
+		template<RandomAccessIterator I1, RandomAccessIterator I2,
+			WeaklyIncrementable O, class Take2>
+		requires Same<iter_value_t<I1>, iter_value_t<I2>> &&
+			IndirectlyCopyable<I1, O> && IndirectlyCopyable<I2, O>
+		constexpr bool merge_copy_block(I1 first1, iter_difference_t<I1>& i,
+			I2 first2, iter_difference_t<I2>& j, O& result, Take2& take2)
+		{
+			iter_value_t<I1> x1 = first1[i + (merge_block - 1)];
+			iter_value_t<I2> x2 = first2[j];
+			if (!take2(x1, x2)) {
+				result = copy(first1 + i, first1 + (i + merge_block), std::move(result)).out;
+				i += merge_block;
+				return true;
+			}
+			x1 = first1[i];
+			x2 = first2[j + (merge_block - 1)];
+			if (take2(x1, x2)) {
+				result = copy(first2 + j, first2 + (j + merge_block), std::move(result)).out;
+				j += merge_block;
+				return true;
+			}
+			return false;
+		}
+
+		// Merges [first1, first1 + n1) and [first2, first2 + n2) to result,
+		// taking the element of the second range when take2(x1, x2) for the
+		// elements x1 and x2 at the front of each. Each step consumes one
+		// element, so neither range can run out within as many steps as the
+		// shorter has left: the inner loop needs no bounds checks of its own.
+		// Between runs of steps, blocks of one range that go before the next
+		// element of the other are copied whole, so that merges of long runs
+		// are as fast as those of a branchy merge. As in a merge in place,
+		// the output may overlap the end of the second range if it lies just
+		// before. Returns the end of the output.
+		template<RandomAccessIterator I1, RandomAccessIterator I2,
+			WeaklyIncrementable O, class Take2>
+		requires Same<iter_value_t<I1>, iter_value_t<I2>> &&
+			IndirectlyCopyable<I1, O> && IndirectlyCopyable<I2, O>
+		constexpr O branchless_merge_forward(I1 first1, const iter_difference_t<I1> n1,
+			I2 first2, const iter_difference_t<I2> n2, O result, Take2& take2)
+		{
+			using V = iter_value_t<I1>;
+			auto i = iter_difference_t<I1>(0);
+			auto j = iter_difference_t<I2>(0);
+			while (true) {
+				const auto left1 = std::ptrdiff_t(n1 - i);
+				const auto left2 = std::ptrdiff_t(n2 - j);
+				const auto left = left1 < left2 ? left1 : left2;
+				if (left == 0) {
+					break;
+				}
+				if (left > merge_block &&
+					merge_copy_block(first1, i, first2, j, result, take2))
+				{
+					continue;
+				}
+				for (auto k = __stl2::min(left, merge_block); k > 0; --k) {
+					V x1 = first1[i];
+					V x2 = first2[j];
+					const bool b = take2(x1, x2);
+					*result = std::move(b ? x2 : x1);
+					++result;
+					j += b;
+					i += !b;
+				}
+			}
+			result = copy(first1 + i, first1 + n1, std::move(result)).out;
+			return copy(first2 + j, first2 + n2, std::move(result)).out;
+		}
+
+		// As branchless_merge_forward, but the output must not overlap
+		// either input. Each step depends on the one before - which element
+		// it loads depends on the last comparison - so this merges from both
+		// ends at once, keeping two chains of steps in flight.
+		template<RandomAccessIterator I1, RandomAccessIterator I2,
+			RandomAccessIterator O, class Take2>
+		requires Same<iter_value_t<I1>, iter_value_t<I2>> &&
+			IndirectlyCopyable<I1, O> && IndirectlyCopyable<I2, O>
+		constexpr O branchless_merge(I1 first1, const iter_difference_t<I1> n1,
+			I2 first2, const iter_difference_t<I2> n2, O result, Take2& take2)
+		{
+			using V = iter_value_t<I1>;
+			const O end = result + iter_difference_t<O>(n1 + n2);
+			// [i, last1) and [j, last2) remain to be merged, to
+			// [result, back).
+			auto i = iter_difference_t<I1>(0);
+			auto last1 = n1;
+			auto j = iter_difference_t<I2>(0);
+			auto last2 = n2;
+			O back = end;
+			while (true) {
+				const auto left1 = std::ptrdiff_t(last1 - i);
+				const auto left2 = std::ptrdiff_t(last2 - j);
+				const auto left = left1 < left2 ? left1 : left2;
+				if (left < 2) {
+					break;
+				}
+				if (left > merge_block &&
+					merge_copy_block(first1, i, first2, j, result, take2))
+				{
+					continue;
+				}
+				for (auto k = __stl2::min(left / 2, merge_block); k > 0; --k) {
+					V x1 = first1[i];
+					V x2 = first2[j];
+					const bool b = take2(x1, x2);
+					*result = std::move(b ? x2 : x1);
+					++result;
+					j += b;
+					i += !b;
+
+					// From the back, the element of the first range goes
+					// last only if the second's is less.
+					V y1 = first1[last1 - 1];
+					V y2 = first2[last2 - 1];
+					const bool c = take2(y1, y2);
+					--back;
+					*back = std::move(c ? y1 : y2);
+					last1 -= c;
+					last2 -= !c;
+				}
+			}
+			branchless_merge_forward(first1 + i, last1 - i, first2 + j, last2 - j,
+				std::move(result), take2);
+			return end;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,169 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_BULK_COPY_HPP
+#define STL2_DETAIL_ALGORITHM_BULK_COPY_HPP
+
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/nontemporal.hpp>
+#include <stl2/detail/algorithm/results.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Bulk copies [Implementation detail]
+//
+// Assignments of trivially copyable objects copy their bytes, so copy,
+// move and their _backward and _n variants copy contiguous ranges of them
+// with a single memmove, as do uninitialized_copy and uninitialized_move
+// for objects that are trivially constructed. Iterator adaptors that only
+// change how the elements are read or counted - move_iterator and
+// counted_iterator - and pairs of reverse_iterators are seen through to
+// the contiguous iterators they adapt. Copies of
+// STL2_NONTEMPORAL_THRESHOLD bytes or more, and those of ext::stream_copy,
+// use non-temporal stores instead when the ranges don't overlap. memmove
+// isn't constexpr: callers guard their uses with
+// detail::is_constant_evaluated.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// How the elements of I lie in memory: when __bulk<I>::type is a
+		// contiguous iterator, the n elements from i are the n objects from
+		// block(i, n), in reverse order if reversed.
+		template<class I>
+		struct __bulk {
+			using type = I;
+			static constexpr bool reversed = false;
+
+			static auto block(const I& i, iter_difference_t<I>) {
+				return std::addressof(*i);
+			}
+			static constexpr I advance(const I& i, const iter_difference_t<I> n) {
+				return i + n;
+			}
+		};
+
+		template<class I>
+		struct __bulk<move_iterator<I>> : __bulk<I> {
+			static auto block(const move_iterator<I>& i, const iter_difference_t<I> n) {
+				return __bulk<I>::block(i.base(), n);
+			}
+			static constexpr move_iterator<I>
+			advance(const move_iterator<I>& i, const iter_difference_t<I> n) {
+				return move_iterator<I>{__bulk<I>::advance(i.base(), n)};
+			}
+		};
+
+		template<class I>
+		struct __bulk<std::move_iterator<I>> : __bulk<I> {
+			static auto block(const std::move_iterator<I>& i, const iter_difference_t<I> n) {
+				return __bulk<I>::block(i.base(), n);
+			}
+			static constexpr std::move_iterator<I>
+			advance(const std::move_iterator<I>& i, const iter_difference_t<I> n) {
+				return std::move_iterator<I>{__bulk<I>::advance(i.base(), n)};
+			}
+		};
+
+		template<class I>
+		struct __bulk<counted_iterator<I>> : __bulk<I> {
+			static auto block(const counted_iterator<I>& i, const iter_difference_t<I> n) {
+				return __bulk<I>::block(i.base(), n);
+			}
+			static constexpr counted_iterator<I>
+			advance(const counted_iterator<I>& i, const iter_difference_t<I> n) {
+				return counted_iterator<I>{__bulk<I>::advance(i.base(), n), i.count() - n};
+			}
+		};
+
+		// The n elements from a reverse_iterator i are those before
+		// i.base(), in reverse.
+		template<class I>
+		struct __bulk<reverse_iterator<I>> : __bulk<I> {
+			static constexpr bool reversed = !__bulk<I>::reversed;
+
+			static auto block(const reverse_iterator<I>& i, const iter_difference_t<I> n) {
+				return __bulk<I>::block(__bulk<I>::advance(i.base(), -n), n);
+			}
+			static constexpr reverse_iterator<I>
+			advance(const reverse_iterator<I>& i, const iter_difference_t<I> n) {
+				return reverse_iterator<I>{__bulk<I>::advance(i.base(), -n)};
+			}
+		};
+
+		template<class I>
+		struct __bulk<std::reverse_iterator<I>> : __bulk<I> {
+			static constexpr bool reversed = !__bulk<I>::reversed;
+
+			static auto block(const std::reverse_iterator<I>& i, const iter_difference_t<I> n) {
+				return __bulk<I>::block(__bulk<I>::advance(i.base(), -n), n);
+			}
+			static constexpr std::reverse_iterator<I>
+			advance(const std::reverse_iterator<I>& i, const iter_difference_t<I> n) {
+				return std::reverse_iterator<I>{__bulk<I>::advance(i.base(), -n)};
+			}
+		};
+
+		template<class I>
+		using __bulk_t = typename __bulk<I>::type;
+
+		// Assigning the elements of I, read as R, to the elements of O
+		// copies their bytes in the same order: copy and move can memmove
+		// the whole range.
+		template<class I, class O, class R>
+		META_CONCEPT __memmovable =
+			ContiguousIterator<__bulk_t<I>> && ContiguousIterator<__bulk_t<O>> &&
+			__bulk<I>::reversed == __bulk<O>::reversed &&
+			Same<iter_value_t<__bulk_t<I>>, iter_value_t<__bulk_t<O>>> &&
+			std::is_trivially_copyable_v<iter_value_t<__bulk_t<I>>> &&
+			std::is_trivially_assignable_v<iter_reference_t<O>, R> &&
+			!std::is_volatile_v<std::remove_reference_t<iter_reference_t<__bulk_t<I>>>> &&
+			!std::is_volatile_v<std::remove_reference_t<iter_reference_t<__bulk_t<O>>>>;
+
+		template<class I, class O>
+		META_CONCEPT __memcopyable = __memmovable<I, O, iter_reference_t<I>>;
+
+		// Constructing the elements of O from those of I, read as R - where
+		// there are no elements yet - copies the same bytes.
+		template<class I, class O, class R>
+		META_CONCEPT __memmove_constructible = __memmovable<I, O, R> &&
+			std::is_trivially_constructible_v<iter_value_t<__bulk_t<O>>, R>;
+
+		// Assigns the n elements from first to the n elements from result,
+		// whose ranges may overlap as they may for copy or copy_backward,
+		// and returns the ends of the ranges. Streams the stores if stream.
+		template<class I, class O>
+		__in_out_result<I, O>
+		bulk_copy(const I& first, const iter_difference_t<I> n, const O& result,
+			const bool stream = false)
+		{
+			using D = iter_difference_t<O>;
+			if (n > 0) {
+				void* const dst = __bulk<O>::block(result, static_cast<D>(n));
+				const void* const src = __bulk<I>::block(first, n);
+				const auto size =
+					static_cast<std::size_t>(n) * sizeof(iter_value_t<__bulk_t<I>>);
+				if ((stream || nontemporal::over_threshold(size)) &&
+					!nontemporal::overlap(dst, src, size))
+				{
+					nontemporal::copy(dst, src, size);
+				} else {
+					std::memmove(dst, src, size);
+				}
+			}
+			return {__bulk<I>::advance(first, n),
+				__bulk<O>::advance(result, static_cast<D>(n))};
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,111 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_BULK_FILL_HPP
+#define STL2_DETAIL_ALGORITHM_BULK_FILL_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/nontemporal.hpp>
+#include <stl2/detail/simd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Bulk fills [Implementation detail]
+//
+// fill and fill_n store one object representation of the value over
+// contiguous ranges of trivially copyable objects, through the adaptors
+// that bulk copies see through, in any order: with memset when its bytes
+// are all the same, as for bytes and zeroes, and otherwise with vectors of
+// copies of it. uninitialized_fill and uninitialized_value_construct do the
+// same for objects that are trivially constructed. Fills of
+// STL2_NONTEMPORAL_THRESHOLD bytes or more, and those of ext::stream_fill,
+// use non-temporal stores. Not constexpr: callers guard their uses with
+// detail::is_constant_evaluated.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Assigning a value of type T to the elements of O stores the
+		// bytes of the value converted to their type.
+		template<class O, class T>
+		META_CONCEPT __memfillable = ContiguousIterator<__bulk_t<O>> &&
+			std::is_trivially_copyable_v<iter_value_t<__bulk_t<O>>> &&
+			std::is_trivially_assignable_v<iter_reference_t<O>, const T&> &&
+			(Same<iter_value_t<__bulk_t<O>>, T> ||
+				(std::is_arithmetic_v<iter_value_t<__bulk_t<O>>> && std::is_arithmetic_v<T>)) &&
+			!std::is_volatile_v<std::remove_reference_t<iter_reference_t<__bulk_t<O>>>>;
+
+		// Constructing the elements of O from a value of type T - where
+		// there are no elements yet - stores the same bytes.
+		template<class O, class T>
+		META_CONCEPT __memconstructible = __memfillable<O, T> &&
+			std::is_trivially_constructible_v<iter_value_t<__bulk_t<O>>, const T&>;
+
+		// Stores n copies of the object representation of value from p.
+		template<class V>
+		void __store_copies(V* const p, const std::size_t n, const V& value) noexcept {
+			unsigned char b[sizeof(V)];
+			std::memcpy(b, std::addressof(value), sizeof(V));
+			bool repeated = true;
+			for (std::size_t i = 1; i < sizeof(V); ++i) {
+				repeated &= b[i] == b[0];
+			}
+			if (repeated) {
+				std::memset(p, b[0], n * sizeof(V));
+				return;
+			}
+			std::size_t i = 0;
+			if constexpr (simd::bytes % sizeof(V) == 0) {
+				// A vector of copies of value, stored every
+				// simd::bytes / sizeof(V) elements
+				constexpr std::size_t k = simd::bytes / sizeof(V);
+				simd::vector<unsigned char> copies;
+				for (std::size_t j = 0; j < k; ++j) {
+					std::memcpy(reinterpret_cast<unsigned char*>(&copies) + j * sizeof(V),
+						b, sizeof(V));
+				}
+				for (; n - i >= k; i += k) {
+					std::memcpy(p + i, &copies, sizeof(copies));
+				}
+			}
+			for (; i < n; ++i) {
+				p[i] = value;
+			}
+		}
+
+		// Assigns value to the n elements from first, or constructs them
+		// from it where __memconstructible, and returns the end of the
+		// range: first itself when n isn't positive, as for fill_n. Streams
+		// the stores if stream.
+		template<class O, class T>
+		O bulk_fill(const O& first, const iter_difference_t<O> n, const T& value,
+			const bool stream = false)
+		{
+			using V = iter_value_t<__bulk_t<O>>;
+			if (n <= 0) {
+				return first;
+			}
+			const auto p = __bulk<O>::block(first, n);
+			const auto size = static_cast<std::size_t>(n);
+			const V v = static_cast<V>(value);
+			if (stream || nontemporal::over_threshold(size * sizeof(V))) {
+				nontemporal::fill(p, size, v);
+			} else {
+				__store_copies(p, size, v);
+			}
+			return __bulk<O>::advance(first, n);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
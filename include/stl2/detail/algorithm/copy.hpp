@@ -14,6 +14,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -28,6 +29,11 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyCopyable<I, O>
 		constexpr copy_result<I, O>
 		operator()(I first, S last, O result) const {
+			if constexpr (SizedSentinel<S, I> && detail::__memcopyable<I, O>) {
+				if (!detail::is_constant_evaluated()) {
+					return detail::bulk_copy(first, last - first, result);
+				}
+			}
 			for (; first != last; (void) ++first, (void) ++result) {
 				*result = *first;
 			}
@@ -50,10 +56,7 @@ STL2_OPEN_NAMESPACE {
 			requires IndirectlyCopyable<I, O>
 			constexpr copy_result<I, O>
 			operator()(I first, S last, O result) const {
-				for (; first != last; (void) ++first, (void) ++result) {
-					*result = *first;
-				}
-				return {std::move(first), std::move(result)};
+				return __stl2::copy(std::move(first), std::move(last), std::move(result));
 			}
 
 			template<InputRange R, class O>
@@ -69,6 +72,15 @@ STL2_OPEN_NAMESPACE {
 			requires IndirectlyCopyable<I1, I2>
 			constexpr copy_result<I1, I2>
 			operator()(I1 first, S1 last, I2 rfirst, S2 rlast) const {
+				if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+					detail::__memcopyable<I1, I2>)
+				{
+					if (!detail::is_constant_evaluated()) {
+						const auto n1 = last - first;
+						const auto n2 = static_cast<iter_difference_t<I1>>(rlast - rfirst);
+						return detail::bulk_copy(first, n1 < n2 ? n1 : n2, rfirst);
+					}
+				}
 				for (; first != last && rfirst != rlast; (void) ++first, (void)++rfirst) {
 					*rfirst = *first;
 				}
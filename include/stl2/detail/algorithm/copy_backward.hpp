@@ -16,6 +16,7 @@
 #include <stl2/iterator.hpp>
 #include <stl2/utility.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
@@ -32,6 +33,14 @@ STL2_OPEN_NAMESPACE {
 		constexpr copy_backward_result<I1, I2>
 		operator()(I1 first, S1 sent, I2 out) const {
 			auto last = next(first, std::move(sent));
+			if constexpr (detail::__memcopyable<I1, I2>) {
+				if (!detail::is_constant_evaluated()) {
+					const auto n = distance(first, last);
+					out -= static_cast<iter_difference_t<I2>>(n);
+					detail::bulk_copy(first, n, out);
+					return {std::move(last), std::move(out)};
+				}
+			}
 			auto i = last;
 			while (i != first) {
 				*--out = *--i;
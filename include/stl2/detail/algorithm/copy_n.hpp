@@ -15,6 +15,8 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/utility.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -31,6 +33,11 @@ STL2_OPEN_NAMESPACE {
 		operator()(I first_, iter_difference_t<I> n, O result) const
 		{
 			STL2_EXPECT(n >= 0);
+			if constexpr (detail::__memcopyable<I, O>) {
+				if (!detail::is_constant_evaluated()) {
+					return detail::bulk_copy(first_, n, result);
+				}
+			}
 			auto norig = n;
 			auto first = __stl2::ext::uncounted(first_);
 			for(; n > 0; ++first, ++result, --n) {
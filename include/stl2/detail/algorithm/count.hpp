@@ -15,11 +15,15 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // count [alg.count]
 //
+// Counts numbers in contiguous ranges with detail::simd::count, a vector
+// at a time.
+//
 STL2_OPEN_NAMESPACE {
 	struct __count_fn : private __niebloid {
 		template<InputIterator I, Sentinel<I> S, class T, class Proj = identity>
@@ -27,6 +31,18 @@ STL2_OPEN_NAMESPACE {
 		constexpr iter_difference_t<I>
 		operator()(I first, S last, const T& value, Proj proj = {}) const
 		{
+			if constexpr (detail::simd::__contiguous_lanes<I> && SizedSentinel<S, I> &&
+				Same<__uncvref<__unwrap<Proj>>, identity> &&
+				detail::simd::__searchable<iter_value_t<I>, T>)
+			{
+				using V = iter_value_t<I>;
+				const auto v = static_cast<V>(value);
+				const auto size = last - first;
+				if (!detail::is_constant_evaluated() && size > 0 && v == value) {
+					return static_cast<iter_difference_t<I>>(
+						detail::simd::count(std::addressof(*first), size, v));
+				}
+			}
 			iter_difference_t<I> n = 0;
 			for (; first != last; ++first) {
 				if (__stl2::invoke(proj, *first) == value) {
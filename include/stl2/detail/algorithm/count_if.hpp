@@ -15,6 +15,7 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -26,6 +27,13 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryPredicate<projected<I, Proj>> Pred>
 		constexpr iter_difference_t<I>
 		operator()(I first, S last, Pred pred, Proj proj = {}) const {
+			if constexpr (detail::simd::__blockwise<I, S, Proj>) {
+				const auto size = last - first;
+				if (!detail::is_constant_evaluated() && size > 0) {
+					return static_cast<iter_difference_t<I>>(
+						detail::simd::count_if(std::addressof(*first), size, pred));
+				}
+			}
 			auto n = iter_difference_t<I>{0};
 			for (; first != last; ++first) {
 				if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
@@ -0,0 +1,190 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_DARY_HEAP_HPP
+#define STL2_DETAIL_ALGORITHM_DARY_HEAP_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/heap_sift.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// d-ary heap algorithms [Extension]
+//
+// ext::make_heap<Arity>, ext::push_heap<Arity>, ext::pop_heap<Arity>,
+// ext::sort_heap<Arity>, ext::is_heap<Arity> and ext::is_heap_until<Arity>
+// work as their namesakes on a heap in which each element has Arity
+// children, adjacent to one another. A pop visits log_Arity(n) groups of
+// children: with 4-ary and 16-byte elements, or 8-ary and 8-byte elements,
+// each group is a cache line - two if the range isn't aligned to start a
+// group on a line boundary - where a binary heap visits twice or three
+// times as many levels. ext::make_heap<2> etc. are the standard algorithms.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<std::ptrdiff_t Arity>
+		requires Arity >= 2
+		struct __make_heap_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires Sortable<I, Comp, Proj>
+			I operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
+			{
+				auto n = distance(first, std::move(last));
+				detail::dary_heap<Arity>::make(first, n, comp, proj);
+				return first + n;
+			}
+
+			template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
+			requires Sortable<iterator_t<Rng>, Comp, Proj>
+			safe_iterator_t<Rng>
+			operator()(Rng&& rng, Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(rng), end(rng),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		template<std::ptrdiff_t Arity>
+		inline constexpr __make_heap_fn<Arity> make_heap {};
+
+		template<std::ptrdiff_t Arity>
+		requires Arity >= 2
+		struct __push_heap_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires Sortable<I, Comp, Proj>
+			I operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
+			{
+				auto n = distance(first, std::move(last));
+				detail::dary_heap<Arity>::sift_up(first, n, comp, proj);
+				return first + n;
+			}
+
+			template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
+			requires Sortable<iterator_t<Rng>, Comp, Proj>
+			safe_iterator_t<Rng>
+			operator()(Rng&& rng, Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(rng), end(rng),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		template<std::ptrdiff_t Arity>
+		inline constexpr __push_heap_fn<Arity> push_heap {};
+
+		template<std::ptrdiff_t Arity>
+		requires Arity >= 2
+		struct __pop_heap_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires Sortable<I, Comp, Proj>
+			I operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
+			{
+				auto n = distance(first, std::move(last));
+				detail::dary_heap<Arity>::pop(first, n, comp, proj);
+				return first + n;
+			}
+
+			template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
+			requires Sortable<iterator_t<Rng>, Comp, Proj>
+			safe_iterator_t<Rng>
+			operator()(Rng&& rng, Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(rng), end(rng),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		template<std::ptrdiff_t Arity>
+		inline constexpr __pop_heap_fn<Arity> pop_heap {};
+
+		template<std::ptrdiff_t Arity>
+		requires Arity >= 2
+		struct __sort_heap_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires Sortable<I, Comp, Proj>
+			I operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
+			{
+				auto n = distance(first, std::move(last));
+				detail::dary_heap<Arity>::sort(first, n, comp, proj);
+				return first + n;
+			}
+
+			template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
+			requires Sortable<iterator_t<Rng>, Comp, Proj>
+			safe_iterator_t<Rng>
+			operator()(Rng&& rng, Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(rng), end(rng),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		template<std::ptrdiff_t Arity>
+		inline constexpr __sort_heap_fn<Arity> sort_heap {};
+
+		template<std::ptrdiff_t Arity>
+		requires Arity >= 2
+		struct __is_heap_until_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<I, Proj>>
+			I operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
+			{
+				auto n = distance(first, std::move(last));
+				return first + detail::dary_heap<Arity>::is_heap_until(
+					first, n, comp, proj);
+			}
+
+			template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<iterator_t<Rng>, Proj>>
+			safe_iterator_t<Rng>
+			operator()(Rng&& rng, Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(rng), end(rng),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		template<std::ptrdiff_t Arity>
+		inline constexpr __is_heap_until_fn<Arity> is_heap_until {};
+
+		template<std::ptrdiff_t Arity>
+		requires Arity >= 2
+		struct __is_heap_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<I, Proj>>
+			bool operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
+			{
+				auto n = distance(first, std::move(last));
+				return detail::dary_heap<Arity>::is_heap_until(first, n, comp, proj) == n;
+			}
+
+			template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<iterator_t<Rng>, Proj>>
+			bool operator()(Rng&& rng, Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(rng), end(rng),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		template<std::ptrdiff_t Arity>
+		inline constexpr __is_heap_fn<Arity> is_heap {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
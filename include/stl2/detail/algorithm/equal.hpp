@@ -15,6 +15,7 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -29,6 +30,15 @@ STL2_OPEN_NAMESPACE {
 		static constexpr bool __equal_3(I1 first1, S1 last1, I2 first2, Pred& pred,
 			Proj1& proj1, Proj2& proj2)
 		{
+			if constexpr (SizedSentinel<S1, I1> &&
+				detail::simd::__comparable_lanes<I1, I2, equal_to, Pred, Proj1, Proj2>)
+			{
+				if (!detail::is_constant_evaluated()) {
+					const auto n = static_cast<std::ptrdiff_t>(last1 - first1);
+					return n == 0 || detail::simd::equal(std::addressof(*first1),
+						std::addressof(*first2), n);
+				}
+			}
 			for (; first1 != last1; ++first1, ++first2) {
 				if (!__stl2::invoke(pred, __stl2::invoke(proj1, *first1), __stl2::invoke(proj2, *first2))) {
 					return false;
@@ -14,6 +14,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_fill.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // fill [alg.fill]
@@ -22,6 +23,11 @@ STL2_OPEN_NAMESPACE {
 		template<class T, OutputIterator<const T&> O, Sentinel<O> S>
 		constexpr O operator()(O first, S last, const T& value) const
 		{
+			if constexpr (SizedSentinel<S, O> && detail::__memfillable<O, T>) {
+				if (!detail::is_constant_evaluated()) {
+					return detail::bulk_fill(first, last - first, value);
+				}
+			}
 			for (; first != last; ++first) {
 				*first = value;
 			}
@@ -14,6 +14,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_fill.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // fill_n [alg.fill]
@@ -23,6 +24,11 @@ STL2_OPEN_NAMESPACE {
 		template<class T, OutputIterator<const T&> O>
 		constexpr O operator()(O first, iter_difference_t<O> n, const T& value) const
 		{
+			if constexpr (detail::__memfillable<O, T>) {
+				if (!detail::is_constant_evaluated()) {
+					return detail::bulk_fill(first, n, value);
+				}
+			}
 			for (; n > 0; --n, (void)++first) {
 				*first = value;
 			}
@@ -15,16 +15,32 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // find [alg.find]
 //
+// Finds numbers in contiguous ranges with detail::simd::find, a vector
+// at a time.
+//
 STL2_OPEN_NAMESPACE {
 	struct __find_fn : private __niebloid {
 		template<InputIterator I, Sentinel<I> S, class T, class Proj = identity>
 		requires IndirectRelation<equal_to, projected<I, Proj>, const T*>
 		constexpr I operator()(I first, S last, const T& value, Proj proj = {}) const {
+			if constexpr (detail::simd::__contiguous_lanes<I> && SizedSentinel<S, I> &&
+				Same<__uncvref<__unwrap<Proj>>, identity> &&
+				detail::simd::__searchable<iter_value_t<I>, T>)
+			{
+				using V = iter_value_t<I>;
+				const auto v = static_cast<V>(value);
+				const auto n = last - first;
+				if (!detail::is_constant_evaluated() && n > 0 && v == value) {
+					return first + static_cast<iter_difference_t<I>>(
+						detail::simd::find(std::addressof(*first), n, v));
+				}
+			}
 			for (; first != last; ++first) {
 				if (__stl2::invoke(proj, *first) == value) {
 					break;
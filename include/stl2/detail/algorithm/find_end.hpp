@@ -18,6 +18,7 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/meta.hpp>
+#include <stl2/detail/algorithm/searcher.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
@@ -39,6 +40,23 @@ STL2_OPEN_NAMESPACE {
 				auto end1 = next(first1, last1);
 				auto end2 = next(first2, last2);
 
+				if constexpr (detail::__two_way_searchable<I1, I2, Pred, Proj1, Proj2>) {
+					// The first occurrence of the reversed pattern in the
+					// reversed text
+					iter_difference_t<I1> n = -1;
+					if constexpr (RandomAccessIterator<I1>) {
+						n = end1 - first1;
+					}
+					if (detail::__use_searcher(n, end2 - first2)) {
+						const auto match = ext::searcher{
+							__stl2::make_reverse_iterator(end2),
+							__stl2::make_reverse_iterator(first2)}(
+							__stl2::make_reverse_iterator(end1),
+							__stl2::make_reverse_iterator(first1));
+						return match.empty() ? end1 : match.end().base();
+					}
+				}
+
 				if constexpr (RandomAccessIterator<I1> && RandomAccessIterator<I2>) {
 					// Take advantage of knowing source and pattern lengths.
 					// Stop short when source is smaller than pattern
@@ -81,6 +99,15 @@ STL2_OPEN_NAMESPACE {
 					return end1;
 				}
 			} else {
+				if constexpr (detail::__two_way_searchable<I1, I2, Pred, Proj1, Proj2>) {
+					const auto m = next(first2, last2) - first2;
+					if (detail::__use_searcher(iter_difference_t<I1>(-1), m)) {
+						// The last occurrence, in one pass over the text
+						return detail::two_way_search(std::move(first1), std::move(last1),
+							first2, m, detail::two_way_factorize(first2, m), true).begin();
+					}
+				}
+
 				std::optional<I1> res;
 				for (; first1 != last1; ++first1) {
 					if (__stl2::invoke(pred, __stl2::invoke(proj1, *first1), __stl2::invoke(proj2, *first2))) {
@@ -0,0 +1,75 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_GALLOP_HPP
+#define STL2_DETAIL_ALGORITHM_GALLOP_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Exponential search [Implementation detail]
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Returns the number of leading elements of [first, first + n) that
+		// satisfy pred, which must partition the range. Probes at
+		// exponentially increasing distances before a binary search, so takes
+		// O(log k) comparisons to return k.
+		template<RandomAccessIterator I, class Pred, class Proj>
+		requires IndirectUnaryPredicate<Pred, projected<I, Proj>>
+		constexpr iter_difference_t<I>
+		gallop(I first, const iter_difference_t<I> n, Pred& pred, Proj& proj)
+		{
+			using D = iter_difference_t<I>;
+			D lo = 0;
+			D step = 1;
+			while (step <= n - lo && __stl2::invoke(pred, __stl2::invoke(proj, first[lo + step - 1]))) {
+				lo += step;
+				step *= 2;
+			}
+			auto hi = step - 1 < n - lo ? D(lo + step - 1) : n;
+			while (lo < hi) {
+				const auto mid = D(lo + (hi - lo) / 2);
+				if (__stl2::invoke(pred, __stl2::invoke(proj, first[mid]))) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
+				}
+			}
+			return lo;
+		}
+
+		// After this many consecutive elements of one input go before the
+		// next element of the other, merge-like algorithms - the adaptive
+		// merge of inplace_merge and stable_sort, includes and
+		// set_intersection - gallop through the rest of the run. Inputs of
+		// about the same size, whose runs are short, are stepped through as
+		// before.
+		inline constexpr int min_gallop = 7;
+
+		// Returns the number of leading elements of [first, first + n) whose
+		// projections go before key, by gallop: skipping over a long run of
+		// a much larger input costs about as much as a binary search.
+		template<RandomAccessIterator I, class T, class Comp, class Proj>
+		constexpr iter_difference_t<I>
+		gallop_before(I first, const iter_difference_t<I> n, const T& key,
+			Comp& comp, Proj& proj)
+		{
+			auto before = [&](auto&& x) -> bool {
+				return __stl2::invoke(comp, static_cast<decltype(x)&&>(x), key);
+			};
+			return gallop(first, n, before, proj);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
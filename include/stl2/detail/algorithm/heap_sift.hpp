@@ -25,93 +25,298 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
-// detail::sift_up_n and detail::sift_down_n
+// detail::dary_heap, detail::sift_up_n and detail::sift_down_n
 // (heap implementation details)
 //
 STL2_OPEN_NAMESPACE {
 	namespace detail {
-		template<RandomAccessIterator I, class Comp, class Proj>
-		requires
-			IndirectStrictWeakOrder<Comp,
-				projected<I, Proj>, projected<I, Proj>>
-		void sift_up_n(I first, iter_difference_t<I> n, Comp comp, Proj proj)
-		{
-			if (n > 1) {
-				I last = first + n;
-				n = (n - 2) / 2;
-				I i = first + n;
-				if (__stl2::invoke(comp, __stl2::invoke(proj, *i), __stl2::invoke(proj, *--last))) {
-					iter_value_t<I> v = iter_move(last);
-					do {
-						*last = iter_move(i);
-						last = i;
-						if (n == 0) {
-							break;
-						}
-						n = (n - 1) / 2;
-						i = first + n;
-					} while(__stl2::invoke(comp, __stl2::invoke(proj, *i), __stl2::invoke(proj, v)));
-					*last = std::move(v);
+		// Heap operations on [first, first + n) laid out as an implicit
+		// Arity-ary tree: the children of the element at i are at
+		// Arity * i + 1 through Arity * i + Arity, and are contiguous.
+		// A wider node makes a shallower tree - log_Arity(n) levels rather
+		// than log_2(n) - and so fewer cache misses in a heap too big for
+		// cache, at the price of Arity - 1 comparisons per level to find
+		// the greatest child.
+		template<std::ptrdiff_t Arity>
+		requires Arity >= 2
+		struct dary_heap {
+			template<class D>
+			static constexpr D parent(const D i) noexcept {
+				return (i - 1) / Arity;
+			}
+
+			template<class D>
+			static constexpr D first_child(const D i) noexcept {
+				return Arity * i + 1;
+			}
+
+			// Restores the heap property of [first, first + n) given that
+			// of [first, first + n - 1). Returns the number of levels the
+			// last element rose.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static iter_difference_t<I> sift_up(I first,
+				const iter_difference_t<I> n, Comp& comp, Proj& proj)
+			{
+				if (n < 2) {
+					return 0;
+				}
+				auto hole = n - 1;
+				auto p = parent(hole);
+				if (!__stl2::invoke(comp, __stl2::invoke(proj, first[p]),
+					__stl2::invoke(proj, first[hole])))
+				{
+					return 0;
 				}
+				iter_value_t<I> v = iter_move(first + hole);
+				iter_difference_t<I> levels = 0;
+				do {
+					first[hole] = iter_move(first + p);
+					hole = p;
+					++levels;
+					if (hole == 0) {
+						break;
+					}
+					p = parent(hole);
+				} while (__stl2::invoke(comp, __stl2::invoke(proj, first[p]),
+					__stl2::invoke(proj, v)));
+				first[hole] = std::move(v);
+				return levels;
 			}
-		}
 
-		template<RandomAccessIterator I, class Comp, class Proj>
-		requires
-			IndirectStrictWeakOrder<Comp,
-				projected<I, Proj>, projected<I, Proj>>
-		void sift_down_n(I first, iter_difference_t<I> n, I start,
-			Comp comp, Proj proj)
-		{
-			// left-child of start is at 2 * start + 1
-			// right-child of start is at 2 * start + 2
-			auto child = start - first;
+			// Restores the heap property of the subtree rooted at start,
+			// given that of the subtrees of its children, by moving the
+			// element at start down until it is not less than its greatest
+			// child. Best when that element likely belongs near the top.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void sift_down(I first, const iter_difference_t<I> n,
+				iter_difference_t<I> start, Comp& comp, Proj& proj)
+			{
+				auto child = first_child(start);
+				if (child >= n) {
+					return;
+				}
+				child = greatest_child(first, n, child, comp, proj);
+				if (__stl2::invoke(comp, __stl2::invoke(proj, first[child]),
+					__stl2::invoke(proj, first[start])))
+				{
+					return;
+				}
+				iter_value_t<I> top = iter_move(first + start);
+				do {
+					first[start] = iter_move(first + child);
+					start = child;
+					child = first_child(start);
+					if (child >= n) {
+						break;
+					}
+					child = greatest_child(first, n, child, comp, proj);
+				} while (!__stl2::invoke(comp, __stl2::invoke(proj, first[child]),
+					__stl2::invoke(proj, top)));
+				first[start] = std::move(top);
+			}
 
-			if (n < 2 || (n - 2) / 2 < child) {
-				return;
+			// Restores the heap property of [first, first + n) given that
+			// of [first, first + h), the heap having grown by a batch of
+			// elements. They are sifted up one at a time while that is cheap,
+			// as when they belong near the bottom - later timers in a
+			// scheduler's queue, say. Once they rise more than a couple of
+			// levels on average, the rest are merged bottom-up instead:
+			// O(n - h + log(n)^2) where sifting up is O((n - h) log(n)).
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void push_n(I first, iter_difference_t<I> h,
+				const iter_difference_t<I> n, Comp& comp, Proj& proj)
+			{
+				STL2_EXPECT(0 <= h && h <= n);
+				iter_difference_t<I> budget = 0;
+				while (h < n) {
+					budget += 2 - sift_up(first, ++h, comp, proj);
+					if (budget < 0) {
+						merge(first, h, n, comp, proj);
+						return;
+					}
+				}
+			}
+
+			// Moves the greatest element of the heap [first, first + n) to
+			// first + n - 1, and restores the heap property of
+			// [first, first + n - 1).
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void pop(I first, const iter_difference_t<I> n,
+				Comp& comp, Proj& proj)
+			{
+				if (n < 2) {
+					return;
+				}
+				iter_value_t<I> v = iter_move(first + (n - 1));
+				first[n - 1] = iter_move(first);
+				fill_hole(first, n - 1, 0, std::move(v), comp, proj);
 			}
 
-			child = 2 * child + 1;
-			I child_i = first + child;
+			// Floyd's construction: heapify the subtrees bottom-up, from the
+			// last parent to the root, in O(n).
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void make(I first, const iter_difference_t<I> n,
+				Comp& comp, Proj& proj)
+			{
+				if (n < 2) {
+					return;
+				}
+				for (auto start = parent(n - 1); start >= 0; --start) {
+					fill_hole(first, n, start, iter_move(first + start), comp, proj);
+				}
+			}
 
-			if ((child + 1) < n && __stl2::invoke(comp, __stl2::invoke(proj, *child_i), __stl2::invoke(proj, *(child_i + 1)))) {
-				// right-child exists and is greater than left-child
-				++child_i;
-				++child;
+			// Moves the k greatest elements of the heap [first, first + n),
+			// greatest first, to out, and restores the heap property of
+			// [first, first + n - k).
+			template<RandomAccessIterator I, WeaklyIncrementable O,
+				class Comp, class Proj>
+			requires Sortable<I, Comp, Proj> && IndirectlyMovable<I, O>
+			static O pop_n(I first, iter_difference_t<I> n,
+				iter_difference_t<I> k, O out, Comp& comp, Proj& proj)
+			{
+				STL2_EXPECT(0 <= k && k <= n);
+				for (; k > 0; --k, ++out) {
+					*out = iter_move(first);
+					if (--n > 0) {
+						fill_hole(first, n, 0, iter_move(first + n), comp, proj);
+					}
+				}
+				return out;
 			}
 
-			// check if we are in heap-order
-			if (__stl2::invoke(comp, __stl2::invoke(proj, *child_i), __stl2::invoke(proj, *start))) {
-				// we are, start is larger than its largest child
-				return;
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void sort(I first, iter_difference_t<I> n,
+				Comp& comp, Proj& proj)
+			{
+				for (; n > 1; --n) {
+					pop(first, n, comp, proj);
+				}
 			}
 
-			iter_value_t<I> top = iter_move(start);
-			do {
-				// we are not in heap-order, swap the parent with it's largest child
-				*start = iter_move(child_i);
-				start = child_i;
+			// Returns the offset of the first element of [first, first + n)
+			// that is greater than its parent, or n.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				IndirectStrictWeakOrder<Comp, projected<I, Proj>>
+			static iter_difference_t<I> is_heap_until(I first,
+				const iter_difference_t<I> n, Comp& comp, Proj& proj)
+			{
+				STL2_EXPECT(0 <= n);
+				for (iter_difference_t<I> p = 0, c = 1; c < n; ++p) {
+					auto&& parent_key = __stl2::invoke(proj, first[p]);
+					const auto last = c + Arity < n ? c + Arity : n;
+					for (; c < last; ++c) {
+						if (__stl2::invoke(comp, parent_key, __stl2::invoke(proj, first[c]))) {
+							return c;
+						}
+					}
+				}
+				return n;
+			}
 
-				if ((n - 2) / 2 < child) {
-					break;
+		private:
+			// Returns the offset of the greatest of the children beginning at
+			// child, which is less than n. (Branches beat conditional moves
+			// here even for scalars: they let the processor speculate the load
+			// of the next level, which dominates in a heap too big for cache.)
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static iter_difference_t<I> greatest_child(I first,
+				const iter_difference_t<I> n, const iter_difference_t<I> child,
+				Comp& comp, Proj& proj)
+			{
+				auto greatest = child;
+				const auto last = n - child > Arity ? child + Arity : n;
+				for (auto c = child + 1; c < last; ++c) {
+					if (__stl2::invoke(comp, __stl2::invoke(proj, first[greatest]),
+						__stl2::invoke(proj, first[c])))
+					{
+						greatest = c;
+					}
 				}
+				return greatest;
+			}
 
-				// recompute the child based off of the updated parent
-				child = 2 * child + 1;
-				child_i = first + child;
+			// Restores the heap property of [first, first + n) given that
+			// of [first, first + h) by sifting down, level by level from the
+			// bottom, each element with one of [first + h, first + n) in its
+			// subtree.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void merge(I first, const iter_difference_t<I> h,
+				const iter_difference_t<I> n, Comp& comp, Proj& proj)
+			{
+				// [lo, hi] are the elements of one level with elements of the
+				// batch in their subtrees; those from done on are heaps.
+				auto lo = h, hi = n - 1, done = n;
+				do {
+					lo = parent(lo);
+					hi = parent(hi);
+					for (auto i = hi < done ? hi : done - 1; i >= lo; --i) {
+						sift_down(first, n, i, comp, proj);
+					}
+					done = lo;
+				} while (lo > 0);
+			}
 
-				if ((child + 1) < n && __stl2::invoke(comp, __stl2::invoke(proj, *child_i), __stl2::invoke(proj, *(child_i + 1)))) {
-					// right-child exists and is greater than left-child
-					++child_i;
-					++child;
+			// Fills the hole at start with v, restoring the heap property of
+			// the subtree rooted there given that of the subtrees of its
+			// children. The hole first descends to a leaf along the greatest
+			// children, and v then rises from there: v, taken from the bottom
+			// of the heap, likely belongs near a leaf, so this saves the
+			// comparison with v at each level of the way down - half the
+			// comparisons of a binary sift down (Wegener, "Bottom-Up-
+			// Heapsort", Theoretical Computer Science 118(1), 1993).
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void fill_hole(I first, const iter_difference_t<I> n,
+				const iter_difference_t<I> start, iter_value_t<I> v,
+				Comp& comp, Proj& proj)
+			{
+				auto hole = start;
+				for (auto child = first_child(hole); child < n; child = first_child(hole)) {
+					child = greatest_child(first, n, child, comp, proj);
+					first[hole] = iter_move(first + child);
+					hole = child;
+				}
+				while (hole != start) {
+					const auto p = parent(hole);
+					if (!__stl2::invoke(comp, __stl2::invoke(proj, first[p]),
+						__stl2::invoke(proj, v)))
+					{
+						break;
+					}
+					first[hole] = iter_move(first + p);
+					hole = p;
 				}
+				first[hole] = std::move(v);
+			}
+		};
+
+		template<RandomAccessIterator I, class Comp, class Proj>
+		requires Sortable<I, Comp, Proj>
+		void sift_up_n(I first, iter_difference_t<I> n, Comp comp, Proj proj)
+		{
+			dary_heap<2>::sift_up(first, n, comp, proj);
+		}
 
-				// check if we are in heap-order
-			} while (!__stl2::invoke(comp, __stl2::invoke(proj, *child_i), __stl2::invoke(proj, top)));
-			*start = std::move(top);
+		template<RandomAccessIterator I, class Comp, class Proj>
+		requires Sortable<I, Comp, Proj>
+		void sift_down_n(I first, iter_difference_t<I> n, I start,
+			Comp comp, Proj proj)
+		{
+			dary_heap<2>::sift_down(first, n, start - first, comp, proj);
 		}
 	}
 } STL2_CLOSE_NAMESPACE
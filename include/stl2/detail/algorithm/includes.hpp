@@ -15,11 +15,17 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/gallop.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // includes [includes]
 //
+// Over a random access first input of known size, gallops through long
+// runs of it that go before the next element of the second: whether n
+// elements include m takes O(m log(n / m)) comparisons, rather than
+// O(m + n).
+//
 STL2_OPEN_NAMESPACE {
 	struct __includes_fn : private  __niebloid {
 		template<InputIterator I1, Sentinel<I1> S1, InputIterator I2, Sentinel<I2> S2,
@@ -29,6 +35,37 @@ STL2_OPEN_NAMESPACE {
 		operator()(I1 first1, S1 last1, I2 first2, S2 last2, Comp comp = {},
 			Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
+			if constexpr (RandomAccessIterator<I1> && SizedSentinel<S1, I1>) {
+				const auto n1 = iter_difference_t<I1>(last1 - first1);
+				auto i = iter_difference_t<I1>(0);
+				// The consecutive elements of the first input that went
+				// before the next element of the second
+				int run = 0;
+				while (first2 != last2) {
+					if (i == n1) {
+						return false;
+					}
+					iter_reference_t<I1>&& v1 = first1[i];
+					iter_reference_t<I2>&& v2 = *first2;
+					auto&& p1 = __stl2::invoke(proj1, v1);
+					auto&& p2 = __stl2::invoke(proj2, v2);
+					if (__stl2::invoke(comp, p2, p1)) {
+						return false;
+					}
+					if (__stl2::invoke(comp, p1, p2)) {
+						if (++run == detail::min_gallop) {
+							i += detail::gallop_before(first1 + i, n1 - i, p2, comp, proj1);
+							run = 0;
+							continue;
+						}
+					} else {
+						++first2;
+						run = 0;
+					}
+					++i;
+				}
+				return true;
+			}
 			while (true) {
 				if (first2 == last2) {
 					return true;
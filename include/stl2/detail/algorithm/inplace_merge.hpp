@@ -27,12 +27,14 @@
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/gallop.hpp>
 #include <stl2/detail/algorithm/move.hpp>
 #include <stl2/detail/algorithm/merge.hpp>
 #include <stl2/detail/algorithm/lower_bound.hpp>
 #include <stl2/detail/algorithm/upper_bound.hpp>
 #include <stl2/detail/algorithm/rotate.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/concepts.hpp>
 #include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -46,6 +48,79 @@ STL2_OPEN_NAMESPACE {
 	namespace detail {
 		struct merge_adaptive_fn {
 		private:
+			// Moves the merge of [first1, last1) and [first2, last2) - taking
+			// the element of the second range only when it is less than that
+			// of the first - to result. After min_gallop consecutive elements
+			// from the same input, finds the rest of the run by galloping and
+			// moves it at once.
+			template<RandomAccessIterator I1, RandomAccessIterator I2, WeaklyIncrementable O,
+				class C, class P>
+			requires
+				IndirectlyMovable<I1, O> && IndirectlyMovable<I2, O>
+			static O gallop_merge(I1 first1, I1 last1, I2 first2, I2 last2, O result,
+				C& pred, P& proj)
+			{
+				int wins1 = 0;
+				int wins2 = 0;
+				while (first1 != last1 && first2 != last2) {
+					if (__stl2::invoke(pred, __stl2::invoke(proj, *first2), __stl2::invoke(proj, *first1))) {
+						*result = iter_move(first2);
+						++first2;
+						++wins2;
+						wins1 = 0;
+					} else {
+						*result = iter_move(first1);
+						++first1;
+						++wins1;
+						wins2 = 0;
+					}
+					++result;
+
+					if (wins1 >= min_gallop && first2 != last2) {
+						auto&& key = __stl2::invoke(proj, *first2);
+						auto not_after = [&](auto&& x) -> bool {
+							return !__stl2::invoke(pred, key, x);
+						};
+						const auto n = gallop(first1, last1 - first1, not_after, proj);
+						auto r = move(first1, first1 + n, std::move(result));
+						first1 = r.in;
+						result = std::move(r.out);
+						wins1 = 0;
+					} else if (wins2 >= min_gallop && first1 != last1) {
+						auto&& key = __stl2::invoke(proj, *first1);
+						auto before = [&](auto&& x) -> bool {
+							return __stl2::invoke(pred, x, key);
+						};
+						const auto n = gallop(first2, last2 - first2, before, proj);
+						auto r = move(first2, first2 + n, std::move(result));
+						first2 = r.in;
+						result = std::move(r.out);
+						wins2 = 0;
+					}
+				}
+				auto r = move(first1, last1, std::move(result));
+				return move(first2, last2, std::move(r.out)).out;
+			}
+
+			template<BidirectionalIterator I1, BidirectionalIterator I2, WeaklyIncrementable O,
+				class C, class P>
+			static O merge_move(I1 first1, I1 last1, I2 first2, I2 last2, O result,
+				C& pred, P& proj)
+			{
+				if constexpr (RandomAccessIterator<I1> && RandomAccessIterator<I2>) {
+					return gallop_merge(std::move(first1), std::move(last1),
+						std::move(first2), std::move(last2), std::move(result), pred, proj);
+				} else {
+					return merge(
+						__stl2::make_move_iterator(std::move(first1)),
+						__stl2::make_move_iterator(std::move(last1)),
+						__stl2::make_move_iterator(std::move(first2)),
+						__stl2::make_move_iterator(std::move(last2)),
+						std::move(result), __stl2::ref(pred),
+						__stl2::ref(proj), __stl2::ref(proj)).out;
+				}
+			}
+
 			template<BidirectionalIterator I, class C, class P>
 			requires
 				Sortable<I, C, P>
@@ -56,26 +131,45 @@ STL2_OPEN_NAMESPACE {
 				STL2_EXPENSIVE_ASSERT(len1 == distance(first, midddle));
 				STL2_EXPENSIVE_ASSERT(len2 == distance(middle, last));
 				temporary_vector<iter_value_t<I>> vec{buf};
+				if constexpr (__branchless_mergeable<I, I, I, C, P, P>) {
+					// Galloping would branch on every element; these merge
+					// faster without.
+					using V = iter_value_t<I>;
+					auto take2 = [&](V& x1, V& x2) -> bool {
+						return __stl2::invoke(pred,
+							__stl2::invoke(proj, x2), __stl2::invoke(proj, x1));
+					};
+					if (len1 + len2 <= buf.size()) {
+						// With both ranges in the buffer, the output overlaps
+						// neither.
+						move(first, last, __stl2::back_inserter(vec));
+						branchless_merge(vec.begin(), len1, vec.begin() + len1, len2,
+							std::move(first), take2);
+					} else if (len1 <= len2) {
+						move(first, middle, __stl2::back_inserter(vec));
+						branchless_merge_forward(vec.begin(), len1, std::move(middle), len2,
+							std::move(first), take2);
+					} else {
+						// Merge from the back, taking the element of the first
+						// range only when it is greater.
+						move(middle, last, __stl2::back_inserter(vec));
+						auto take1 = [&](V& x2, V& x1) { return take2(x1, x2); };
+						using RBi = reverse_iterator<I>;
+						branchless_merge_forward(rbegin(vec), len2, RBi{std::move(middle)}, len1,
+							RBi{std::move(last)}, take1);
+					}
+					return;
+				}
 				if (len1 <= len2) {
 					move(first, middle, __stl2::back_inserter(vec));
-					merge(
-						__stl2::make_move_iterator(begin(vec)),
-						__stl2::make_move_iterator(end(vec)),
-						__stl2::make_move_iterator(std::move(middle)),
-						__stl2::make_move_iterator(std::move(last)),
-						std::move(first), __stl2::ref(pred),
-						__stl2::ref(proj), __stl2::ref(proj));
+					merge_move(begin(vec), end(vec), std::move(middle), std::move(last),
+						std::move(first), pred, proj);
 				} else {
 					move(middle, last, __stl2::back_inserter(vec));
 					using RBi = reverse_iterator<I>;
-					merge(
-						__stl2::make_move_iterator(RBi{std::move(middle)}),
-						__stl2::make_move_iterator(RBi{std::move(first)}),
-						__stl2::make_move_iterator(rbegin(vec)),
-						__stl2::make_move_iterator(rend(vec)),
-						RBi{std::move(last)},
-						__stl2::not_fn(__stl2::ref(pred)),
-						__stl2::ref(proj), __stl2::ref(proj));
+					auto rpred = __stl2::not_fn(__stl2::ref(pred));
+					merge_move(RBi{std::move(middle)}, RBi{std::move(first)},
+						rbegin(vec), rend(vec), RBi{std::move(last)}, rpred, proj);
 				}
 			}
 
@@ -186,6 +280,15 @@ STL2_OPEN_NAMESPACE {
 		};
 
 		inline constexpr inplace_merge_no_buffer_fn inplace_merge_no_buffer {};
+
+		// Merges [first, middle) and [middle, last) with the tasks of a
+		// parallel merge: the elements move to a buffer, a slice for each
+		// task, then merge back. Returns false, having done nothing, if the
+		// range is too short to share or no buffer is available. Defined in
+		// <stl2/execution.hpp>.
+		template<RandomAccessIterator I, class C, class P>
+		requires Sortable<I, C, P>
+		bool parallel_inplace_merge(I first, I middle, I last, C& comp, P& proj);
 	}
 
 	template<BidirectionalIterator I, Sentinel<I> S, class Comp = less,
@@ -213,6 +316,34 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::inplace_merge(begin(rng), std::move(middle),
 			end(rng), __stl2::ref(comp), __stl2::ref(proj));
 	}
+
+	// Extension: inplace_merge with an execution policy.
+	template<ext::ExecutionPolicy EP, RandomAccessIterator I, Sentinel<I> S,
+		class Comp = less, class Proj = identity>
+	requires Sortable<I, Comp, Proj>
+	I inplace_merge(EP&&, I first, I middle, S sent, Comp comp = {}, Proj proj = {})
+	{
+		auto last = next(middle, std::move(sent));
+		if constexpr (ext::__parallel_policy<EP>) {
+			if (detail::parallel_inplace_merge(first, middle, last, comp, proj)) {
+				return last;
+			}
+		}
+		return __stl2::inplace_merge(std::move(first), std::move(middle),
+			last, __stl2::ref(comp), __stl2::ref(proj));
+	}
+
+	// Extension: inplace_merge with an execution policy.
+	template<ext::ExecutionPolicy EP, RandomAccessRange Rng, class Comp = less,
+		class Proj = identity>
+	requires Sortable<iterator_t<Rng>, Comp, Proj>
+	safe_iterator_t<Rng>
+	inplace_merge(EP&& ep, Rng&& rng, iterator_t<Rng> middle, Comp comp = {},
+		Proj proj = {})
+	{
+		return __stl2::inplace_merge(std::forward<EP>(ep), begin(rng), std::move(middle),
+			end(rng), __stl2::ref(comp), __stl2::ref(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -15,6 +15,7 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -29,6 +30,17 @@ STL2_OPEN_NAMESPACE {
 	bool lexicographical_compare(I1 first1, S1 last1, I2 first2, S2 last2,
 		Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {})
 	{
+		if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+			detail::simd::__comparable_lanes<I1, I2, less, Comp, Proj1, Proj2>)
+		{
+			const auto n1 = static_cast<std::ptrdiff_t>(last1 - first1);
+			const auto n2 = static_cast<std::ptrdiff_t>(last2 - first2);
+			if (n1 == 0 || n2 == 0) {
+				return n1 < n2;
+			}
+			return detail::simd::lexicographical_compare(std::addressof(*first1), n1,
+				std::addressof(*first2), n2);
+		}
 		for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
 			if (__stl2::invoke(comp, __stl2::invoke(proj1, *first1), __stl2::invoke(proj2, *first2))) {
 				return true;
@@ -38,13 +38,7 @@ STL2_OPEN_NAMESPACE {
 			Sortable<I, Comp, Proj>
 		void make_heap_n(I first, iter_difference_t<I> n, Comp comp, Proj proj)
 		{
-			if (n > 1) {
-				// start from the first parent, there is no need to consider children
-				for (auto start = (n - 2) / 2; start >= 0; --start) {
-					detail::sift_down_n(first, n, first + start,
-						__stl2::ref(comp), __stl2::ref(proj));
-				}
-			}
+			detail::dary_heap<2>::make(first, n, comp, proj);
 		}
 	}
 
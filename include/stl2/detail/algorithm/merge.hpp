@@ -14,9 +14,11 @@
 
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
+#include <stl2/detail/algorithm/branchless_merge.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // merge [alg.merge]
@@ -34,6 +36,25 @@ STL2_OPEN_NAMESPACE {
 		operator()(I1 first1, S1 last1, I2 first2, S2 last2, O result,
 			Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
+			if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+				detail::__branchless_mergeable<I1, I2, O, Comp, Proj1, Proj2>)
+			{
+				const auto n1 = iter_difference_t<I1>(last1 - first1);
+				const auto n2 = iter_difference_t<I2>(last2 - first2);
+				using V = iter_value_t<I1>;
+				auto take2 = [&](V& x1, V& x2) -> bool {
+					return __stl2::invoke(comp,
+						__stl2::invoke(proj2, x2), __stl2::invoke(proj1, x1));
+				};
+				if constexpr (RandomAccessIterator<O>) {
+					result = detail::branchless_merge(first1, n1, first2, n2,
+						std::move(result), take2);
+				} else {
+					result = detail::branchless_merge_forward(first1, n1, first2, n2,
+						std::move(result), take2);
+				}
+				return {first1 + n1, first2 + n2, std::move(result)};
+			}
 			while (true) {
 				if (first1 == last1) {
 					auto cresult = copy(std::move(first2), std::move(last2), std::move(result));
@@ -49,12 +70,12 @@ STL2_OPEN_NAMESPACE {
 				}
 				iter_reference_t<I1>&& v1 = *first1;
 				iter_reference_t<I2>&& v2 = *first2;
-				if (__stl2::invoke(comp, __stl2::invoke(proj1, v1), __stl2::invoke(proj2, v2))) {
-					*result = std::forward<iter_reference_t<I1>>(v1);
-					++first1;
-				} else {
+				if (__stl2::invoke(comp, __stl2::invoke(proj2, v2), __stl2::invoke(proj1, v1))) {
 					*result = std::forward<iter_reference_t<I2>>(v2);
 					++first2;
+				} else {
+					*result = std::forward<iter_reference_t<I1>>(v1);
+					++first1;
 				}
 				++result;
 			}
@@ -71,6 +92,53 @@ STL2_OPEN_NAMESPACE {
 			return (*this)(begin(r1), end(r1), begin(r2), end(r2),
 				std::move(result), __stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
 		}
+
+		// Extension: merge with an execution policy. Each task merges the
+		// pieces of the inputs that make an equal slice of the output,
+		// split along the merge path.
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I1, Sentinel<I1> S1,
+			RandomAccessIterator I2, Sentinel<I2> S2, RandomAccessIterator O,
+			class Comp = less, class Proj1 = identity, class Proj2 = identity>
+		requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+		merge_result<I1, I2, O>
+		operator()(EP&&, I1 first1, S1 sent1, I2 first2, S2 sent2, O result,
+			Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
+		{
+			auto last1 = next(first1, std::move(sent1));
+			auto last2 = next(first2, std::move(sent2));
+			if constexpr (ext::__parallel_policy<EP>) {
+				auto out = parallel_merge(first1, iter_difference_t<I1>(last1 - first1),
+					first2, iter_difference_t<I2>(last2 - first2), std::move(result),
+					comp, proj1, proj2);
+				return {std::move(last1), std::move(last2), std::move(out)};
+			}
+			return (*this)(std::move(first1), std::move(last1), std::move(first2),
+				std::move(last2), std::move(result), __stl2::ref(comp),
+				__stl2::ref(proj1), __stl2::ref(proj2));
+		}
+
+		// Extension: merge with an execution policy.
+		template<ext::ExecutionPolicy EP, RandomAccessRange R1, RandomAccessRange R2,
+			RandomAccessIterator O, class Comp = less, class Proj1 = identity,
+			class Proj2 = identity>
+		requires Mergeable<iterator_t<R1>, iterator_t<R2>, O, Comp, Proj1, Proj2>
+		merge_result<safe_iterator_t<R1>, safe_iterator_t<R2>, O>
+		operator()(EP&& ep, R1&& r1, R2&& r2, O result, Comp comp = {},
+			Proj1 proj1 = {}, Proj2 proj2 = {}) const
+		{
+			return (*this)(std::forward<EP>(ep), begin(r1), end(r1), begin(r2), end(r2),
+				std::move(result), __stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
+		}
+
+	private:
+		// merge on the tasks of the thread pool, defined in
+		// <stl2/execution.hpp>.
+		template<RandomAccessIterator I1, RandomAccessIterator I2,
+			RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+		requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+		static O parallel_merge(I1 first1, iter_difference_t<I1> n1,
+			I2 first2, iter_difference_t<I2> n2, O result,
+			Comp& comp, Proj1& proj1, Proj2& proj2);
 	};
 
 	inline constexpr __merge_fn merge {};
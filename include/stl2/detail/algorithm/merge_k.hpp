@@ -0,0 +1,222 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_MERGE_K_HPP
+#define STL2_DETAIL_ALGORITHM_MERGE_K_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/merge.hpp>
+#include <stl2/detail/algorithm/pdq_partition.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/view/all.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// merge_k [Extension]
+//
+// Merges the sorted ranges that are the elements of a range of ranges in
+// one pass, with a tree of losers after Knuth (TAOCP Vol. 3, 5.4.1): each
+// element output replays the matches on one path from leaf to root, at
+// most ceil(log2(k)) of them, and the tree of k indices stays in cache
+// however long the ranges. Where a fold of pairwise merges reads and
+// writes each element log2(k) times, merge_k does so once. Equivalent
+// elements keep the order of the ranges that hold them, as merge keeps
+// those of the first range before those of the second.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// The heads of k input ranges, merged by a tree of losers.
+		template<InputIterator I, Sentinel<I> S, class Comp, class Proj>
+		requires IndirectStrictWeakOrder<Comp, projected<I, Proj>>
+		class loser_tree {
+			using key_t = __uncvref<indirect_result_t<Proj&, I>>;
+			// Keys cheap to copy and compare are kept in an array by the
+			// tree, so that the matches read neither the ranges nor their
+			// iterators, and are played without branches.
+			static constexpr bool cache_keys =
+				__builtin_order<Comp> && std::is_arithmetic_v<key_t>;
+
+			std::vector<I> heads_;
+			std::vector<S> ends_;
+			// Whether each range is exhausted.
+			std::vector<unsigned char> done_;
+			// The key of each range's head.
+			std::vector<std::conditional_t<cache_keys, key_t, char>> keys_;
+			// tree_[0] is the index of the winner - the range with the least
+			// head - and tree_[1, k) those of the losers of the matches at
+			// each node. The leaf for range i is the virtual node k + i.
+			std::vector<std::size_t> tree_;
+			Comp& comp_;
+			Proj& proj_;
+
+			void read_head(const std::size_t i) {
+				done_[i] = heads_[i] == ends_[i];
+				if constexpr (cache_keys) {
+					if (!done_[i]) {
+						keys_[i] = __stl2::invoke(proj_, *heads_[i]);
+					}
+				}
+			}
+
+			// The range of index a plays before that of index b: its head
+			// is less, or equivalent and a < b. An exhausted range plays
+			// after all others.
+			bool beats(const std::size_t a, const std::size_t b) {
+				if constexpr (cache_keys) {
+					const bool a_less = __stl2::invoke(comp_, keys_[a], keys_[b]);
+					const bool b_less = __stl2::invoke(comp_, keys_[b], keys_[a]);
+					const bool a_done = done_[a], b_done = done_[b];
+					return (!a_done) & (b_done | a_less | ((!b_less) & (a < b)));
+				} else {
+					if (done_[a]) {
+						return false;
+					}
+					if (done_[b]) {
+						return true;
+					}
+					if (__stl2::invoke(comp_, __stl2::invoke(proj_, *heads_[b]),
+						__stl2::invoke(proj_, *heads_[a])))
+					{
+						return false;
+					}
+					return a < b || __stl2::invoke(comp_,
+						__stl2::invoke(proj_, *heads_[a]), __stl2::invoke(proj_, *heads_[b]));
+				}
+			}
+
+		public:
+			loser_tree(std::vector<I> heads, std::vector<S> ends, Comp& comp, Proj& proj)
+			: heads_(std::move(heads)), ends_(std::move(ends)), comp_{comp}, proj_{proj}
+			{
+				STL2_EXPECT(heads_.size() == ends_.size());
+				const std::size_t k = heads_.size();
+				done_.resize(k);
+				if constexpr (cache_keys) {
+					keys_.resize(k);
+				}
+				for (std::size_t i = 0; i < k; ++i) {
+					read_head(i);
+				}
+				tree_.resize(k);
+				if (k < 2) {
+					return;
+				}
+				// Play the matches bottom up, keeping the winner of each
+				// to play at its parent.
+				std::vector<std::size_t> winners(2 * k);
+				for (std::size_t i = 0; i < k; ++i) {
+					winners[k + i] = i;
+				}
+				for (std::size_t node = k - 1; node > 0; --node) {
+					const std::size_t a = winners[2 * node];
+					const std::size_t b = winners[2 * node + 1];
+					if (beats(a, b)) {
+						winners[node] = a;
+						tree_[node] = b;
+					} else {
+						winners[node] = b;
+						tree_[node] = a;
+					}
+				}
+				tree_[0] = winners[1];
+			}
+
+			// Whether every range is exhausted.
+			bool empty() const {
+				return heads_.empty() || done_[tree_[0]];
+			}
+
+			// The head of the winning range.
+			I& top() {
+				STL2_EXPECT(!empty());
+				return heads_[tree_[0]];
+			}
+
+			// Advances the winning range, and replays its matches.
+			void pop() {
+				STL2_EXPECT(!empty());
+				std::size_t w = tree_[0];
+				++heads_[w];
+				read_head(w);
+				const std::size_t k = heads_.size();
+				for (std::size_t node = (k + w) / 2; node > 0; node /= 2) {
+					const std::size_t loser = tree_[node];
+					if constexpr (cache_keys) {
+						const bool b = beats(loser, w);
+						tree_[node] = b ? w : loser;
+						w = b ? loser : w;
+					} else if (beats(loser, w)) {
+						tree_[node] = w;
+						w = loser;
+					}
+				}
+				tree_[0] = w;
+			}
+		};
+	}
+
+	namespace ext {
+		template<class Rng>
+		using __merge_k_inner = iter_reference_t<iterator_t<Rng>>;
+
+		struct __merge_k_fn : private __niebloid {
+			template<InputRange Rng, WeaklyIncrementable O, class Comp = less,
+				class Proj = identity>
+			requires InputRange<__merge_k_inner<Rng>> &&
+				ViewableRange<__merge_k_inner<Rng>> &&
+				IndirectlyCopyable<iterator_t<__merge_k_inner<Rng>>, O> &&
+				IndirectStrictWeakOrder<Comp,
+					projected<iterator_t<__merge_k_inner<Rng>>, Proj>>
+			O operator()(Rng&& rngs, O result, Comp comp = {}, Proj proj = {}) const
+			{
+				using V = all_view<__merge_k_inner<Rng>>;
+				// All of the ranges must outlive their iterators.
+				std::vector<V> views;
+				for (auto i = begin(rngs); i != end(rngs); ++i) {
+					views.push_back(view::all(*i));
+				}
+				std::vector<iterator_t<V>> heads;
+				std::vector<sentinel_t<V>> ends;
+				heads.reserve(views.size());
+				ends.reserve(views.size());
+				for (auto& v : views) {
+					heads.push_back(begin(v));
+					ends.push_back(end(v));
+				}
+				if (views.size() == 1) {
+					return copy(std::move(heads[0]), std::move(ends[0]),
+						std::move(result)).out;
+				}
+				if (views.size() == 2) {
+					return merge(std::move(heads[0]), std::move(ends[0]),
+						std::move(heads[1]), std::move(ends[1]), std::move(result),
+						__stl2::ref(comp), __stl2::ref(proj), __stl2::ref(proj)).out;
+				}
+				detail::loser_tree<iterator_t<V>, sentinel_t<V>, Comp, Proj> tree{
+					std::move(heads), std::move(ends), comp, proj};
+				for (; !tree.empty(); tree.pop()) {
+					*result = *tree.top();
+					++result;
+				}
+				return result;
+			}
+		};
+
+		inline constexpr __merge_k_fn merge_k {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -15,6 +15,7 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/utility.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
@@ -33,6 +34,22 @@ STL2_OPEN_NAMESPACE {
 		operator()(I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = {},
 			Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
+			if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+				detail::simd::__comparable_lanes<I1, I2, equal_to, Pred, Proj1, Proj2>)
+			{
+				if (!detail::is_constant_evaluated()) {
+					const auto n1 = static_cast<std::ptrdiff_t>(last1 - first1);
+					const auto n2 = static_cast<std::ptrdiff_t>(last2 - first2);
+					const auto n = n1 < n2 ? n1 : n2;
+					if (n == 0) {
+						return {std::move(first1), std::move(first2)};
+					}
+					const auto i = detail::simd::mismatch(std::addressof(*first1),
+						std::addressof(*first2), n);
+					return {first1 + static_cast<iter_difference_t<I1>>(i),
+						first2 + static_cast<iter_difference_t<I2>>(i)};
+				}
+			}
 			for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
 				if (!__stl2::invoke(pred, __stl2::invoke(proj1, *first1), __stl2::invoke(proj2, *first2))) {
 					break;
@@ -14,6 +14,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 
@@ -29,6 +30,13 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyMovable<I, O>
 		constexpr move_result<I, O>
 		operator()(I first, S last, O result) const {
+			if constexpr (SizedSentinel<S, I> &&
+				detail::__memmovable<I, O, iter_rvalue_reference_t<I>>)
+			{
+				if (!detail::is_constant_evaluated()) {
+					return detail::bulk_copy(first, last - first, result);
+				}
+			}
 			for (; first != last; (void) ++first, (void) ++result) {
 				*result = iter_move(first);
 			}
@@ -51,10 +59,7 @@ STL2_OPEN_NAMESPACE {
 			requires IndirectlyMovable<I, O>
 			constexpr move_result<I, O>
 			operator()(I first, S last, O result) const {
-				for (; first != last; (void) ++first, (void) ++result) {
-					*result = iter_move(first);
-				}
-				return {std::move(first), std::move(result)};
+				return __stl2::move(std::move(first), std::move(last), std::move(result));
 			}
 
 			template<InputRange R, class O>
@@ -70,6 +75,15 @@ STL2_OPEN_NAMESPACE {
 			requires IndirectlyMovable<I1, I2>
 			constexpr move_result<I1, I2>
 			operator()(I1 first1, S1 last1, I2 first2, S2 last2) const {
+				if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+					detail::__memmovable<I1, I2, iter_rvalue_reference_t<I1>>)
+				{
+					if (!detail::is_constant_evaluated()) {
+						const auto n1 = last1 - first1;
+						const auto n2 = static_cast<iter_difference_t<I1>>(last2 - first2);
+						return detail::bulk_copy(first1, n1 < n2 ? n1 : n2, first2);
+					}
+				}
 				for (; first1 != last1 && first2 != last2; (void) ++first1, (void) ++first2) {
 					*first2 = iter_move(first1);
 				}
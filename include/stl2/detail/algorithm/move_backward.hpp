@@ -13,6 +13,8 @@
 #define STL2_DETAIL_ALGORITHM_MOVE_BACKWARD_HPP
 
 #include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -28,6 +30,14 @@ STL2_OPEN_NAMESPACE {
 		constexpr move_backward_result<I1, I2>
 		operator()(I1 first, S1 s, I2 result) const {
 			auto last = next(first, std::move(s));
+			if constexpr (detail::__memmovable<I1, I2, iter_rvalue_reference_t<I1>>) {
+				if (!detail::is_constant_evaluated()) {
+					const auto n = distance(first, last);
+					result -= static_cast<iter_difference_t<I2>>(n);
+					detail::bulk_copy(first, n, result);
+					return {std::move(last), std::move(result)};
+				}
+			}
 			auto i = last;
 			while (i != first) {
 				*--result = iter_move(--i);
@@ -10,22 +10,17 @@
 //
 // Project home: https://github.com/caseycarter/cmcstl2
 //
-//===----------------------------------------------------------------------===//
-//
-//                     The LLVM Compiler Infrastructure
-//
-// This file is dual licensed under the MIT and the University of Illinois Open
-// Source Licenses. See LICENSE.TXT for details.
-//
-//===----------------------------------------------------------------------===//
-//
 #ifndef STL2_DETAIL_ALGORITHM_NTH_ELEMENT_HPP
 #define STL2_DETAIL_ALGORITHM_NTH_ELEMENT_HPP
 
+#include <cmath>
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/max_element.hpp>
 #include <stl2/detail/algorithm/min_element.hpp>
+#include <stl2/detail/algorithm/pdq_partition.hpp>
+#include <stl2/detail/algorithm/random_access_sort.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -33,241 +28,174 @@
 //
 STL2_OPEN_NAMESPACE {
 	namespace detail {
-		// stable, 2-3 compares, 0-2 swaps
-		template<class I, class C, class P>
-		requires
-			Sortable<I, C, P>
-		unsigned sort3(I x, I y, I z, C& comp, P& proj)
-		{
-			if (!__stl2::invoke(comp, __stl2::invoke(proj, *y), __stl2::invoke(proj, *x))) {      // if x <= y
-				if (!__stl2::invoke(comp, __stl2::invoke(proj, *z), __stl2::invoke(proj, *y))) {  // if y <= z
-					return 0;                     // x <= y && y <= z
-				}
-				                                  // x <= y && y > z
-				iter_swap(y, z);          // x <= z && y < z
-				if (__stl2::invoke(comp, __stl2::invoke(proj, *y), __stl2::invoke(proj, *x))) {   // if x > y
-					iter_swap(x, y);      // x < y && y <= z
-					return 2;
-				}
-				return 1;                         // x <= y && y < z
-			}
-			if (__stl2::invoke(comp, __stl2::invoke(proj, *z), __stl2::invoke(proj, *y))) {       // x > y, if y > z
-				iter_swap(x, z);          // x < y && y < z
-				return 1;
-			}
-			iter_swap(x, y);              // x > y && y <= z
-			                                      // x < y && x <= z
-			if (__stl2::invoke(comp, __stl2::invoke(proj, *z), __stl2::invoke(proj, *y))) {       // if y > z
-				iter_swap(y, z);          // x <= y && y < z
-				return 2;
-			}
-			return 1;
-		}
+		// Quickselect over the pdqsort partitions. Large ranges take their
+		// pivot from a recursive selection in a sample around nth, after
+		// Floyd and Rivest, "Algorithm 489: The Algorithm SELECT" (CACM
+		// 18(3), 1975), which needs about n + min(k, n - k) comparisons.
+		// Should the partitioning work exceed a small multiple of n, the
+		// pivots are instead chosen by median of medians, which bounds the
+		// worst case to O(n).
+		struct introselect {
+			// Ranges no longer than this are insertion sorted.
+			static constexpr std::ptrdiff_t insertion_sort_threshold = 16;
+			// Ranges at least this long take a Floyd-Rivest pivot.
+			static constexpr std::ptrdiff_t floyd_rivest_threshold = 600;
+			// Elements that may be partitioned, per element of the range,
+			// before switching to median of medians.
+			static constexpr std::ptrdiff_t work_budget_factor = 6;
 
-		template<BidirectionalIterator I, class C, class P>
-		requires
-			Sortable<I, C, P>
-		void selection_sort(I begin, I end, C &comp, P &proj)
-		{
-			STL2_EXPECT(begin != end);
-			for (I lm1 = prev(end); begin != lm1; ++begin) {
-				I i = __stl2::min_element(begin, end, __stl2::ref(comp), __stl2::ref(proj));
-				if (i != begin) {
-					iter_swap(begin, i);
-				}
+			// Places the element that belongs at nth in sorted order there,
+			// with no element of [first, nth) greater and no element of
+			// (nth, last) less.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void select(I first, I nth, I last, Comp& comp, Proj& proj)
+			{
+				STL2_EXPECT(first <= nth && nth < last);
+				loop(first, nth, last,
+					work_budget_factor * iter_difference_t<I>(last - first), comp, proj);
 			}
-		}
-	}
 
-	// TODO: refactor this monstrosity.
-	template<RandomAccessIterator I, Sentinel<I> S, class Comp = less, class Proj = identity>
-	requires
-		Sortable<I, Comp, Proj>
-	I nth_element(I first, I nth, S last, Comp comp = {}, Proj proj = {})
-	{
-		I end = next(nth, last), end_orig = end;
-		constexpr iter_difference_t<I> limit = 7;
-		while (true) {
-		restart:
-			if (nth == end) {
-				return end_orig;
-			}
-			iter_difference_t<I> len = end - first;
-			switch (len) {
-			case 0:
-			case 1:
-				return end_orig;
-			case 2:
-				if (__stl2::invoke(comp, __stl2::invoke(proj, *--end), __stl2::invoke(proj, *first))) {
-					iter_swap(first, end);
-				}
-				return end_orig;
-			case 3:
-				{
-					I m = first;
-					detail::sort3(first, ++m, --end, comp, proj);
-					return end_orig;
-				}
-			}
-			if (len <= limit) {
-				detail::selection_sort(first, end, comp, proj);
-				return end_orig;
-			}
-			static_assert(limit >= 3);
-			// len > limit >= 3
-			I m = first + len/2;
-			I lm1 = end;
-			unsigned n_swaps = detail::sort3(first, m, --lm1, comp, proj);
-			// *m is median
-			// partition [first, m) < *m and *m <= [m, end)
-			//(this inhibits tossing elements equivalent to m around unnecessarily)
-			I i = first;
-			I j = lm1;
-			// j points beyond range to be tested, *lm1 is known to be <= *m
-			// The search going up is known to be guarded but the search coming down isn't.
-			// Prime the downward search with a guard.
-			if (!__stl2::invoke(comp, __stl2::invoke(proj, *i), __stl2::invoke(proj, *m))) {  // if *first == *m
-				// *first == *m, *first doesn't go in first part
-				// manually guard downward moving j against i
+		private:
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void loop(I first, I nth, I last, iter_difference_t<I> budget,
+				Comp& comp, Proj& proj)
+			{
+				bool leftmost = true;
 				while (true) {
-					if (i == --j) {
-						// *first == *m, *m <= all other elements
-						// Parition instead into [first, i) == *first and *first < [i, end)
-						++i;  // first + 1
-						j = end;
-						if (!__stl2::invoke(comp, __stl2::invoke(proj, *first), __stl2::invoke(proj, *--j))) {  // we need a guard if *first == *(end-1)
-							while (true) {
-								if (i == j) {
-									return end_orig;  // [first, end) all equivalent elements
-								}
-								if (__stl2::invoke(comp, __stl2::invoke(proj, *first), __stl2::invoke(proj, *i))) {
-									iter_swap(i, j);
-									++n_swaps;
-									++i;
-									break;
-								}
-								++i;
-							}
-						}
-						// [first, i) == *first and *first < [j, end) and j == end - 1
-						if (i == j) {
-							return end_orig;
-						}
-						while (true) {
-							while (!__stl2::invoke(comp, __stl2::invoke(proj, *first), __stl2::invoke(proj, *i)))
-								++i;
-							while (__stl2::invoke(comp, __stl2::invoke(proj, *first), __stl2::invoke(proj, *--j)))
-								;
-							if (i >= j)
-								break;
-							iter_swap(i, j);
-							++n_swaps;
-							++i;
-						}
-						// [first, i) == *first and *first < [i, end)
-						// The first part is sorted,
-						if (nth < i) {
-							return end_orig;
-						}
-						// nth_element the second part
-						// nth_element<C>(i, nth, end, comp);
-						first = i;
-						goto restart;
+					const auto n = iter_difference_t<I>(last - first);
+					if (n <= insertion_sort_threshold) {
+						detail::rsort::insertion_sort(first, last, comp, proj);
+						return;
 					}
-					if (__stl2::invoke(comp, __stl2::invoke(proj, *j), __stl2::invoke(proj, *m))) {
-						iter_swap(i, j);
-						++n_swaps;
-						break;  // found guard for downward moving j, now use unguarded partition
+					if (nth == first) {
+						iter_swap(first, __stl2::min_element(first, last,
+							__stl2::ref(comp), __stl2::ref(proj)));
+						return;
 					}
-				}
-			}
-			++i;
-			// j points beyond range to be tested, *lm1 is known to be <= *m
-			// if not yet partitioned...
-			if (i < j) {
-				// known that *(i - 1) < *m
-				while (true) {
-					// m still guards upward moving i
-					while (__stl2::invoke(comp, __stl2::invoke(proj, *i), __stl2::invoke(proj, *m))) {
-						++i;
+					if (nth == prev(last)) {
+						iter_swap(nth, __stl2::max_element(first, last,
+							__stl2::ref(comp), __stl2::ref(proj)));
+						return;
 					}
-					// It is now known that a guard exists for downward moving j
-					while (!__stl2::invoke(comp, __stl2::invoke(proj, *--j), __stl2::invoke(proj, *m))) {
-						;
+
+					if (budget <= 0) {
+						median_of_medians(first, last, comp, proj);
+					} else if (n >= floyd_rivest_threshold) {
+						floyd_rivest(first, nth, last, comp, proj);
+					} else {
+						pdq_partition::choose_pivot(first, last, comp, proj);
+					}
+					budget -= n;
+
+					// As in pdqsort: if the pivot is equivalent to the element
+					// before the range, which bounds it from below, gather all
+					// elements equivalent to the pivot on the left.
+					if (!leftmost && !__stl2::invoke(comp,
+						__stl2::invoke(proj, *prev(first)), __stl2::invoke(proj, *first)))
+					{
+						I p = pdq_partition::left(first, last, comp, proj);
+						if (nth <= p) {
+							return; // [first, p] are all equivalent
+						}
+						first = next(p);
+						continue;
 					}
-					if (i >= j) {
-						break;
+					I p = pdq_partition::right(first, last, comp, proj).first;
+					if (nth == p) {
+						return;
 					}
-					iter_swap(i, j);
-					++n_swaps;
-					// It is known that m != j
-					// If m just moved, follow it
-					if (m == i) {
-						m = j;
+					if (nth < p) {
+						last = p;
+					} else {
+						first = next(p);
+						leftmost = false;
 					}
-					++i;
 				}
 			}
-			// [first, i) < *m and *m <= [i, end)
-			if (i != m && __stl2::invoke(comp, __stl2::invoke(proj, *m), __stl2::invoke(proj, *i))) {
-				iter_swap(i, m);
-				++n_swaps;
-			}
-			// [first, i) < *i and *i <= [i+1, end)
-			if (nth == i) {
-				return end_orig;
+
+			// Places at first an estimate of the element that belongs at
+			// nth: the element selected at nth within a sample of the range,
+			// gathered around nth and skewed so that nth likely falls in the
+			// smaller partition. Precondition: first < nth < last - 1.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void floyd_rivest(I first, I nth, I last, Comp& comp, Proj& proj)
+			{
+				using D = iter_difference_t<I>;
+				const auto n = static_cast<double>(last - first);
+				const auto k = static_cast<double>(nth - first);
+				const double z = std::log(n);
+				const double s = 0.5 * std::exp(2.0 * z / 3.0);
+				const double sd = 0.5 * std::sqrt(z * s * (n - s) / n) *
+					(k < n / 2 ? -1.0 : 1.0);
+				auto lo = static_cast<D>(k - k * s / n + sd);
+				auto hi = static_cast<D>(k + (n - k) * s / n + sd);
+				// Keep nth inside the sample, with an element after it: that
+				// element is not less than the pivot, which right() needs.
+				const auto i = D(nth - first);
+				lo = lo < 0 ? D(0) : (lo > i ? i : lo);
+				hi = hi <= i ? i + 1 : (hi > D(last - first) - 1 ? D(last - first) - 1 : hi);
+				const I sample_first = first + lo;
+				const I sample_last = first + (hi + 1);
+				// Gather a sample spread evenly over the range, so that input
+				// that is already partly ordered - e.g., by an earlier
+				// selection - doesn't bias it.
+				const auto m = D(sample_last - sample_first);
+				const auto stride = D(last - first) / m;
+				for (D j = 0; j < m; ++j) {
+					iter_swap(sample_first + j, first + j * stride);
+				}
+				loop(sample_first, nth, sample_last,
+					work_budget_factor * D(sample_last - sample_first), comp, proj);
+				iter_swap(first, nth);
 			}
-			if (n_swaps == 0) {
-				// We were given a perfectly partitioned sequence.  Coincidence?
-				if (nth < i) {
-					// Check for [first, i) already sorted
-					j = m = first;
-					while (++j != i) {
-						if (__stl2::invoke(comp, __stl2::invoke(proj, *j), __stl2::invoke(proj, *m))) {
-							// not yet sorted, so sort
-							goto not_sorted;
-						}
-						m = j;
-					}
-					// [first, i) sorted
-					return end_orig;
-				} else {
-					// Check for [i, end) already sorted
-					j = m = i;
-					while (++j != end) {
-						if (__stl2::invoke(comp, __stl2::invoke(proj, *j), __stl2::invoke(proj, *m))) {
-							// not yet sorted, so sort
-							goto not_sorted;
-						}
-						m = j;
-					}
-					// [i, end) sorted
-					return end_orig;
+
+			// Places at first the median of the medians of groups of five
+			// elements. At least 3/10 of the range is not less than it, and
+			// 3/10 not greater.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static void median_of_medians(I first, I last, Comp& comp, Proj& proj)
+			{
+				I medians = first;
+				for (I group = first; last - group >= 5; group += 5) {
+					detail::rsort::insertion_sort(group, group + 5, comp, proj);
+					iter_swap(medians, group + 2);
+					++medians;
 				}
+				const I mid = first + (medians - first) / 2;
+				loop(first, mid, medians, iter_difference_t<I>(0), comp, proj);
+				iter_swap(first, mid);
 			}
-		not_sorted:
-			// nth_element on range containing nth
-			if (nth < i) {
-				// nth_element<C>(first, nth, i, comp);
-				end = i;
-			} else {
-				// nth_element<C>(i+1, nth, end, comp);
-				first = ++i;
+		};
+	}
+
+	struct __nth_element_fn : private __niebloid {
+		template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+			class Proj = identity>
+		requires Sortable<I, Comp, Proj>
+		I operator()(I first, I nth, S last, Comp comp = {}, Proj proj = {}) const
+		{
+			I end = next(nth, std::move(last));
+			if (nth != end) {
+				detail::introselect::select(first, nth, end, comp, proj);
 			}
+			return end;
 		}
-		return end_orig;
-	}
 
-	template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
-	requires
-		Sortable<iterator_t<Rng>, Comp, Proj>
-	safe_iterator_t<Rng>
-	nth_element(Rng&& rng, iterator_t<Rng> nth, Comp comp = {}, Proj proj = {})
-	{
-		return __stl2::nth_element(
-			begin(rng), std::move(nth), end(rng),
-			__stl2::ref(comp), __stl2::ref(proj));
-	}
+		template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
+		requires Sortable<iterator_t<Rng>, Comp, Proj>
+		safe_iterator_t<Rng>
+		operator()(Rng&& rng, iterator_t<Rng> nth, Comp comp = {}, Proj proj = {}) const
+		{
+			return (*this)(begin(rng), std::move(nth), end(rng),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
+	};
+
+	inline constexpr __nth_element_fn nth_element {};
 } STL2_CLOSE_NAMESPACE
 
 #endif
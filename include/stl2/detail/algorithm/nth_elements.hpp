@@ -0,0 +1,124 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_NTH_ELEMENTS_HPP
+#define STL2_DETAIL_ALGORITHM_NTH_ELEMENTS_HPP
+
+#include <initializer_list>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/nth_element.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/unique.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// nth_elements [Extension]
+//
+// nth_element for several positions at once - e.g., the offsets of the
+// 50th, 90th, 99th and 99.9th percentiles. Each selection partitions the
+// range for the positions on either side of it, so k positions cost
+// O(n log k) rather than O(n k).
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __nth_elements_fn : private __niebloid {
+		private:
+			template<class I, class D, class Comp, class Proj>
+			static void select(I const base, I first, I last,
+				const D* pfirst, const D* plast, Comp& comp, Proj& proj)
+			{
+				while (pfirst != plast) {
+					// Select the middle position, then the positions on
+					// each side of it within the partitions it leaves.
+					const D* pmid = pfirst + (plast - pfirst) / 2;
+					const I nth = base + *pmid;
+					detail::introselect::select(first, nth, last, comp, proj);
+					if (pmid - pfirst < plast - pmid) {
+						select(base, first, nth, pfirst, pmid, comp, proj);
+						first = next(nth);
+						pfirst = pmid + 1;
+					} else {
+						select(base, next(nth), last, pmid + 1, plast, comp, proj);
+						last = nth;
+						plast = pmid;
+					}
+				}
+			}
+
+			template<class I, class P, class Comp, class Proj>
+			static I impl(I first, I end, P&& positions, Comp& comp, Proj& proj)
+			{
+				using D = iter_difference_t<I>;
+				const auto n = D(end - first);
+				std::vector<D> sorted;
+				for (auto&& p : positions) {
+					const D pos = static_cast<D>(p);
+					STL2_EXPECT(0 <= pos && pos < n);
+					sorted.push_back(pos);
+				}
+				__stl2::sort(sorted);
+				sorted.erase(__stl2::unique(sorted), sorted.end());
+				select(first, first, end, sorted.data(), sorted.data() + sorted.size(),
+					comp, proj);
+				return end;
+			}
+
+		public:
+			template<RandomAccessIterator I, Sentinel<I> S, InputRange P,
+				class Comp = less, class Proj = identity>
+			requires Sortable<I, Comp, Proj> &&
+				ConvertibleTo<iter_reference_t<iterator_t<P>>, iter_difference_t<I>>
+			I operator()(I first, S last, P&& positions, Comp comp = {}, Proj proj = {}) const
+			{
+				I end = next(first, std::move(last));
+				return impl(std::move(first), std::move(end), positions, comp, proj);
+			}
+
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires Sortable<I, Comp, Proj>
+			I operator()(I first, S last, std::initializer_list<iter_difference_t<I>> positions,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				I end = next(first, std::move(last));
+				return impl(std::move(first), std::move(end), positions, comp, proj);
+			}
+
+			template<RandomAccessRange R, InputRange P, class Comp = less,
+				class Proj = identity>
+			requires Sortable<iterator_t<R>, Comp, Proj> &&
+				ConvertibleTo<iter_reference_t<iterator_t<P>>, iter_difference_t<iterator_t<R>>>
+			safe_iterator_t<R> operator()(R&& r, P&& positions, Comp comp = {}, Proj proj = {}) const
+			{
+				auto first = begin(r);
+				auto last = next(first, end(r));
+				return impl(std::move(first), std::move(last), positions, comp, proj);
+			}
+
+			template<RandomAccessRange R, class Comp = less, class Proj = identity>
+			requires Sortable<iterator_t<R>, Comp, Proj>
+			safe_iterator_t<R> operator()(R&& r,
+				std::initializer_list<iter_difference_t<iterator_t<R>>> positions,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				auto first = begin(r);
+				auto last = next(first, end(r));
+				return impl(std::move(first), std::move(last), positions, comp, proj);
+			}
+		};
+
+		inline constexpr __nth_elements_fn nth_elements {};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -13,21 +13,57 @@
 #ifndef STL2_DETAIL_ALGORITHM_PARTIAL_SORT_COPY_HPP
 #define STL2_DETAIL_ALGORITHM_PARTIAL_SORT_COPY_HPP
 
+#include <optional>
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/heap_sift.hpp>
 #include <stl2/detail/algorithm/make_heap.hpp>
+#include <stl2/detail/algorithm/move.hpp>
 #include <stl2/detail/algorithm/sort_heap.hpp>
+#include <stl2/detail/algorithm/top_k.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/temporary_vector.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // partial_sort_copy [partial.sort.copy]
 //
 STL2_OPEN_NAMESPACE {
 	struct __partial_sort_copy_fn : private __niebloid {
+	private:
+		template<class I1, class I2, class Comp, class Proj2>
+		static constexpr bool __streamable =
+			Constructible<iter_value_t<I2>, iter_reference_t<I1>> &&
+			Sortable<iter_value_t<I2>*, Comp, Proj2> &&
+			IndirectlyMovable<iter_value_t<I2>*, I2>;
+
+		// Streams the input through a buffer of 2k or more, pruning it
+		// with nth_element, rather than through a heap of k, where each
+		// element that displaces the top costs O(log k). Returns nothing -
+		// and consumes no input - when no buffer can be had.
+		template<class I1, class S1, class I2, class S2, class Comp, class Proj1, class Proj2>
+		static std::optional<I2> stream(I1& first, S1& last, I2& result_first, S2& result_last,
+			Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			using V = iter_value_t<I2>;
+			const auto k = std::ptrdiff_t(distance(result_first, result_last));
+			if (k == 0) {
+				return result_first;
+			}
+			const auto capacity = detail::top_k_buffer_size(k);
+			detail::temporary_buffer<V> buf{capacity};
+			if (buf.size() < capacity) {
+				return std::nullopt;
+			}
+			auto vec = detail::make_temporary_vector(buf);
+			detail::stream_top_k(std::move(first), std::move(last), vec, k,
+				comp, proj1, proj2);
+			return __stl2::move(vec.begin(), vec.end(), std::move(result_first)).out;
+		}
+
+	public:
 		template<InputIterator I1, Sentinel<I1> S1, RandomAccessIterator I2, Sentinel<I2> S2,
 			class Proj1 = identity, class Proj2 = identity,
 			IndirectStrictWeakOrder<projected<I1, Proj1>, projected<I2, Proj2>> Comp = less>
@@ -36,6 +72,14 @@ STL2_OPEN_NAMESPACE {
 		operator()(I1 first, S1 last, I2 result_first, S2 result_last,
 			Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
+			if constexpr (__streamable<I1, I2, Comp, Proj2>) {
+				if (auto r = stream(first, last, result_first, result_last,
+					comp, proj1, proj2))
+				{
+					return *r;
+				}
+			}
+
 			auto r = result_first;
 			if(r != result_last) {
 				auto cresult = ext::copy(std::move(first), last, std::move(r), result_last);
@@ -0,0 +1,353 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Copyright (c) 2015 Orson Peters
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from
+// the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software in
+//    a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+#ifndef STL2_DETAIL_ALGORITHM_PDQ_PARTITION_HPP
+#define STL2_DETAIL_ALGORITHM_PDQ_PARTITION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Pivot selection and partitioning for pdqsort [Implementation detail]
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class C>
+		inline constexpr bool __is_builtin_order_ = false;
+		template<>
+		inline constexpr bool __is_builtin_order_<less> = true;
+		template<>
+		inline constexpr bool __is_builtin_order_<greater> = true;
+		template<class T>
+		inline constexpr bool __is_builtin_order_<std::less<T>> = true;
+		template<class T>
+		inline constexpr bool __is_builtin_order_<std::greater<T>> = true;
+
+		// Comp is one of the standard ordering function objects (possibly
+		// passed through reference_wrapper).
+		template<class Comp>
+		META_CONCEPT __builtin_order =
+			__is_builtin_order_<__uncvref<__unwrap<Comp>>>;
+
+		// Comparisons of the projected values are cheap enough - and
+		// unpredictable enough - that branch-free algorithms win.
+		template<class I, class Comp, class Proj>
+		META_CONCEPT __branchless_sortable =
+			RandomAccessIterator<I> && Sortable<I, Comp, Proj> &&
+			__builtin_order<Comp> &&
+			std::is_arithmetic_v<__uncvref<indirect_result_t<Proj&, I>>>;
+
+		struct pdq_partition {
+			// Partitions above this size use Tukey's ninther to select the pivot.
+			static constexpr std::ptrdiff_t ninther_threshold = 128;
+			// Number of elements classified at a time by the block partition.
+			static constexpr std::ptrdiff_t block_size = 64;
+
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static constexpr void sort2(I a, I b, Comp& comp, Proj& proj)
+			{
+				if (__stl2::invoke(comp, __stl2::invoke(proj, *b), __stl2::invoke(proj, *a))) {
+					iter_swap(a, b);
+				}
+			}
+
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static constexpr void sort3(I a, I b, I c, Comp& comp, Proj& proj)
+			{
+				sort2(a, b, comp, proj);
+				sort2(b, c, comp, proj);
+				sort2(a, b, comp, proj);
+			}
+
+			// Places the median of [first, mid, last - 1] - or, for large
+			// ranges, Tukey's ninther - at first. Afterwards, [first + 1, last)
+			// contains an element not less than *first.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static constexpr void choose_pivot(I first, I last, Comp& comp, Proj& proj)
+			{
+				const auto n = iter_difference_t<I>(last - first);
+				STL2_EXPECT(n >= 3);
+				const auto half = n / 2;
+				if (n > ninther_threshold) {
+					sort3(first, first + half, last - 1, comp, proj);
+					sort3(first + 1, first + (half - 1), last - 2, comp, proj);
+					sort3(first + 2, first + (half + 1), last - 3, comp, proj);
+					sort3(first + (half - 1), first + half, first + (half + 1), comp, proj);
+					iter_swap(first, first + half);
+				} else {
+					sort3(first + half, first, last - 1, comp, proj);
+				}
+			}
+
+			// Partitions [first, last) around the pivot *first. Elements
+			// equivalent to the pivot end up in the right partition. Returns
+			// the final position of the pivot, and whether the range was
+			// already partitioned.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static constexpr std::pair<I, bool>
+			right(I const first, I const last, Comp& comp, Proj& proj)
+			{
+				if constexpr (__branchless_sortable<I, Comp, Proj>) {
+					return right_branchless(first, last, comp, proj);
+				} else {
+					return right_branchy(first, last, comp, proj);
+				}
+			}
+
+			// Partitions [first, last) around the pivot *first. Elements
+			// equivalent to the pivot end up in the left partition. Used when
+			// the pivot is known to be equivalent to the preceding element -
+			// i.e., when the input has many duplicates - to put all of them in
+			// place at once. Returns the final position of the pivot.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static constexpr I left(I const first, I const last, Comp& comp, Proj& proj)
+			{
+				iter_value_t<I> pivot_value = iter_move(first);
+				auto&& pivot = __stl2::invoke(proj, pivot_value);
+
+				I i = first;
+				I j = last;
+				while (__stl2::invoke(comp, pivot, __stl2::invoke(proj, *--j))) {
+					; // do nothing
+				}
+				if (next(j) == last) {
+					while (i < j && !__stl2::invoke(comp, pivot, __stl2::invoke(proj, *++i))) {
+						; // do nothing
+					}
+				} else {
+					while (!__stl2::invoke(comp, pivot, __stl2::invoke(proj, *++i))) {
+						; // do nothing
+					}
+				}
+
+				while (i < j) {
+					iter_swap(i, j);
+					while (__stl2::invoke(comp, pivot, __stl2::invoke(proj, *--j))) {
+						; // do nothing
+					}
+					while (!__stl2::invoke(comp, pivot, __stl2::invoke(proj, *++i))) {
+						; // do nothing
+					}
+				}
+
+				*first = iter_move(j);
+				*j = std::move(pivot_value);
+				return j;
+			}
+
+		private:
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static constexpr std::pair<I, bool>
+			right_branchy(I const first, I const last, Comp& comp, Proj& proj)
+			{
+				iter_value_t<I> pivot_value = iter_move(first);
+				auto&& pivot = __stl2::invoke(proj, pivot_value);
+
+				I i = first;
+				I j = last;
+				// choose_pivot guarantees an element >= pivot exists to the right.
+				while (__stl2::invoke(comp, __stl2::invoke(proj, *++i), pivot)) {
+					; // do nothing
+				}
+				// If no element was moved past, there is no guard for j.
+				if (prev(i) == first) {
+					while (i < j && !__stl2::invoke(comp, __stl2::invoke(proj, *--j), pivot)) {
+						; // do nothing
+					}
+				} else {
+					while (!__stl2::invoke(comp, __stl2::invoke(proj, *--j), pivot)) {
+						; // do nothing
+					}
+				}
+
+				const bool already_partitioned = i >= j;
+				while (i < j) {
+					iter_swap(i, j);
+					while (__stl2::invoke(comp, __stl2::invoke(proj, *++i), pivot)) {
+						; // do nothing
+					}
+					while (!__stl2::invoke(comp, __stl2::invoke(proj, *--j), pivot)) {
+						; // do nothing
+					}
+				}
+
+				I pivot_pos = prev(i);
+				*first = iter_move(pivot_pos);
+				*pivot_pos = std::move(pivot_value);
+				return {pivot_pos, already_partitioned};
+			}
+
+			// Exchanges the n elements at offsets_l from lbase with those at
+			// offsets_r back from rbase. When there are leftover elements on one
+			// side a cyclic permutation is used, which needs about half the
+			// moves of the swaps.
+			template<RandomAccessIterator I>
+			requires Permutable<I>
+			static constexpr void swap_offsets(I lbase, I rbase,
+				unsigned char const* offsets_l, unsigned char const* offsets_r,
+				std::ptrdiff_t n, bool use_swaps)
+			{
+				if (use_swaps) {
+					// Same number of elements on both sides: the cyclic
+					// permutation would be incorrect.
+					for (std::ptrdiff_t k = 0; k < n; ++k) {
+						iter_swap(lbase + offsets_l[k], rbase - offsets_r[k]);
+					}
+				} else if (n > 0) {
+					I l = lbase + offsets_l[0];
+					I r = rbase - offsets_r[0];
+					iter_value_t<I> tmp = iter_move(l);
+					*l = iter_move(r);
+					for (std::ptrdiff_t k = 1; k < n; ++k) {
+						l = lbase + offsets_l[k];
+						*r = iter_move(l);
+						r = rbase - offsets_r[k];
+						*l = iter_move(r);
+					}
+					*r = std::move(tmp);
+				}
+			}
+
+			// The same contract as right_branchy, but the elements are
+			// classified a block at a time and the comparison results are
+			// accumulated into offset buffers without branching. From
+			// "BlockQuicksort: How Branch Mispredictions don't affect
+			// Quicksort" by Stefan Edelkamp and Armin Weiss.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static constexpr std::pair<I, bool>
+			right_branchless(I const first, I const last, Comp& comp, Proj& proj)
+			{
+				iter_value_t<I> pivot_value = iter_move(first);
+				auto&& pivot = __stl2::invoke(proj, pivot_value);
+
+				I i = first;
+				I j = last;
+				while (__stl2::invoke(comp, __stl2::invoke(proj, *++i), pivot)) {
+					; // do nothing
+				}
+				if (prev(i) == first) {
+					while (i < j && !__stl2::invoke(comp, __stl2::invoke(proj, *--j), pivot)) {
+						; // do nothing
+					}
+				} else {
+					while (!__stl2::invoke(comp, __stl2::invoke(proj, *--j), pivot)) {
+						; // do nothing
+					}
+				}
+
+				const bool already_partitioned = i >= j;
+				if (!already_partitioned) {
+					iter_swap(i, j);
+					++i;
+
+					alignas(64) unsigned char offsets_l[block_size] = {};
+					alignas(64) unsigned char offsets_r[block_size] = {};
+					I lbase = i;
+					I rbase = j;
+					std::ptrdiff_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+					while (i < j) {
+						// Decide how many unknown elements to classify on each
+						// side; a side whose block still holds offsets sits out.
+						const auto unknown = std::ptrdiff_t(j - i);
+						const auto left_split =
+							num_l == 0 ? (num_r == 0 ? unknown / 2 : unknown) : 0;
+						const auto right_split =
+							num_r == 0 ? unknown - left_split : 0;
+
+						const auto n_l = left_split < block_size ? left_split : block_size;
+						for (std::ptrdiff_t k = 0; k < n_l; ++k) {
+							offsets_l[num_l] = static_cast<unsigned char>(k);
+							num_l += !__stl2::invoke(comp, __stl2::invoke(proj, *i), pivot);
+							++i;
+						}
+						const auto n_r = right_split < block_size ? right_split : block_size;
+						for (std::ptrdiff_t k = 1; k <= n_r; ++k) {
+							offsets_r[num_r] = static_cast<unsigned char>(k);
+							num_r += __stl2::invoke(comp, __stl2::invoke(proj, *--j), pivot);
+						}
+
+						const auto n = num_l < num_r ? num_l : num_r;
+						swap_offsets(lbase, rbase, offsets_l + start_l, offsets_r + start_r,
+							n, num_l == num_r);
+						num_l -= n;
+						num_r -= n;
+						start_l += n;
+						start_r += n;
+
+						if (num_l == 0) {
+							start_l = 0;
+							lbase = i;
+						}
+						if (num_r == 0) {
+							start_r = 0;
+							rbase = j;
+						}
+					}
+
+					// [i, j) is empty; move the remaining misplaced elements of
+					// the one non-empty block to the boundary.
+					if (num_l) {
+						while (num_l--) {
+							iter_swap(lbase + offsets_l[start_l + num_l], --j);
+						}
+						i = j;
+					}
+					if (num_r) {
+						while (num_r--) {
+							iter_swap(rbase - offsets_r[start_r + num_r], i);
+							++i;
+						}
+					}
+				}
+
+				I pivot_pos = prev(i);
+				*first = iter_move(pivot_pos);
+				*pivot_pos = std::move(pivot_value);
+				return {pivot_pos, already_partitioned};
+			}
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -26,6 +26,7 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/heap_sift.hpp>
+#include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -38,11 +39,7 @@ STL2_OPEN_NAMESPACE {
 			Sortable<I, Comp, Proj>
 		void pop_heap_n(I first, iter_difference_t<I> n, Comp comp, Proj proj)
 		{
-			if (n > 1) {
-				iter_swap(first, first + (n - 1));
-				detail::sift_down_n(first, n - 1, first, __stl2::ref(comp),
-					__stl2::ref(proj));
-			}
+			detail::dary_heap<2>::pop(first, n, comp, proj);
 		}
 	}
 
@@ -67,6 +64,46 @@ STL2_OPEN_NAMESPACE {
 		detail::pop_heap_n(begin(rng), n, __stl2::ref(comp), __stl2::ref(proj));
 		return begin(rng) + n;
 	}
+
+	namespace ext {
+		template<class I, class O>
+		using pop_heap_n_result = __in_out_result<I, O>;
+
+		// Moves the k greatest elements of the heap [first, last) - or all of
+		// them, if it has fewer - to out, greatest first, leaving a heap of
+		// the rest at the front. Returns the end of that heap and of the
+		// output.
+		struct __pop_heap_n_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, WeaklyIncrementable O,
+				class Comp = less, class Proj = identity>
+			requires Sortable<I, Comp, Proj> && IndirectlyMovable<I, O>
+			pop_heap_n_result<I, O> operator()(I first, S last,
+				iter_difference_t<I> k, O out, Comp comp = {}, Proj proj = {}) const
+			{
+				auto n = distance(first, std::move(last));
+				STL2_EXPECT(0 <= k);
+				if (k > n) {
+					k = n;
+				}
+				out = detail::dary_heap<2>::pop_n(first, n, k, std::move(out), comp, proj);
+				return {first + (n - k), std::move(out)};
+			}
+
+			template<RandomAccessRange Rng, WeaklyIncrementable O,
+				class Comp = less, class Proj = identity>
+			requires Sortable<iterator_t<Rng>, Comp, Proj> &&
+				IndirectlyMovable<iterator_t<Rng>, O>
+			pop_heap_n_result<safe_iterator_t<Rng>, O>
+			operator()(Rng&& rng, iter_difference_t<iterator_t<Rng>> k, O out,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(rng), end(rng), k, std::move(out),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __pop_heap_n_fn pop_heap_n {};
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
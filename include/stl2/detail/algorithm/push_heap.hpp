@@ -53,6 +53,33 @@ STL2_OPEN_NAMESPACE {
 		detail::sift_up_n(begin(rng), n, __stl2::ref(comp), __stl2::ref(proj));
 		return begin(rng) + n;
 	}
+
+	namespace ext {
+		// Makes a heap of [first, last) given the heap [first, mid): pushes
+		// all of [mid, last) at once.
+		struct __push_heap_n_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires Sortable<I, Comp, Proj>
+			I operator()(I first, I mid, S last, Comp comp = {}, Proj proj = {}) const
+			{
+				auto n = distance(first, std::move(last));
+				detail::dary_heap<2>::push_n(first, mid - first, n, comp, proj);
+				return first + n;
+			}
+
+			template<RandomAccessRange Rng, class Comp = less, class Proj = identity>
+			requires Sortable<iterator_t<Rng>, Comp, Proj>
+			safe_iterator_t<Rng>
+			operator()(Rng&& rng, iterator_t<Rng> mid, Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(rng), std::move(mid), end(rng),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __push_heap_n_fn push_heap_n {};
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -0,0 +1,68 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_RADIX_SORT_HPP
+#define STL2_DETAIL_ALGORITHM_RADIX_SORT_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/radix_sort_n.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// radix_sort [Extension]
+//
+// Sorts by a projected key in ascending order without comparisons. Keys
+// may be of any integral type, float, double, std::string or
+// std::string_view. Falls back to sort - or stable_sort - when the
+// elements can't be moved without throwing or no scratch space is
+// available.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I, class Proj>
+		META_CONCEPT __radix_key =
+			Sortable<I, less, Proj> &&
+			(detail::__radix_number_key<__uncvref<indirect_result_t<Proj&, I>>> ||
+			 detail::__radix_string_key<__uncvref<indirect_result_t<Proj&, I>>>);
+
+		template<bool Stable>
+		struct __radix_sort_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Proj = identity>
+			requires __radix_key<I, Proj>
+			I operator()(I first, S last_, Proj proj = {}) const
+			{
+				auto last = next(first, std::move(last_));
+				if (!detail::radix_sort_n(first, distance(first, last), proj)) {
+					if constexpr (Stable) {
+						__stl2::stable_sort(first, last, less{}, __stl2::ref(proj));
+					} else {
+						__stl2::sort(first, last, less{}, __stl2::ref(proj));
+					}
+				}
+				return last;
+			}
+
+			template<RandomAccessRange R, class Proj = identity>
+			requires __radix_key<iterator_t<R>, Proj>
+			safe_iterator_t<R> operator()(R&& r, Proj proj = {}) const
+			{
+				return (*this)(begin(r), end(r), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __radix_sort_fn<false> radix_sort {};
+		inline constexpr __radix_sort_fn<true> stable_radix_sort {};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,376 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_RADIX_SORT_N_HPP
+#define STL2_DETAIL_ALGORITHM_RADIX_SORT_N_HPP
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/random_access_sort.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/concepts/fundamental.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// radix sort [Implementation detail]
+//
+// LSD radix sort for integral and floating-point keys, and MSD radix sort
+// for byte-string keys. Both are stable.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Maps a key to an unsigned integer with the same ordering under <.
+		template<class T>
+		struct radix_key_traits {};
+
+		template<Integral T>
+		struct radix_key_traits<T> {
+			using key_type = std::make_unsigned_t<
+				meta::if_c<Same<T, bool>, unsigned char, T>>;
+
+			static key_type encode(T t) noexcept {
+				auto k = static_cast<key_type>(t);
+				if constexpr (std::is_signed_v<T>) {
+					// Flip the sign bit so negative values sort first.
+					k ^= key_type(1) << (sizeof(key_type) * CHAR_BIT - 1);
+				}
+				return k;
+			}
+		};
+
+		template<class T>
+		requires
+			(Same<T, float> || Same<T, double>) &&
+			std::numeric_limits<T>::is_iec559
+		struct radix_key_traits<T> {
+			using key_type = meta::if_c<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+			static key_type encode(T t) noexcept {
+				static_assert(sizeof(key_type) == sizeof(T));
+				if (t == T(0)) {
+					t = T(0); // -0.0 and +0.0 are equivalent
+				}
+				key_type k;
+				std::memcpy(&k, &t, sizeof(k));
+				// Negative values: flip all bits to reverse their order.
+				// Positive values: flip the sign bit to order them after
+				// the negatives.
+				constexpr auto sign = key_type(1) << (sizeof(key_type) * CHAR_BIT - 1);
+				return (k & sign) ? key_type(~k) : key_type(k | sign);
+			}
+		};
+
+		template<class T>
+		inline constexpr bool __is_byte_string_ = false;
+		template<class A>
+		inline constexpr bool __is_byte_string_<
+			std::basic_string<char, std::char_traits<char>, A>> = true;
+		template<>
+		inline constexpr bool __is_byte_string_<std::string_view> = true;
+
+		template<class T>
+		META_CONCEPT __radix_number_key =
+			requires { typename radix_key_traits<T>::key_type; };
+
+		template<class T>
+		META_CONCEPT __radix_string_key = __is_byte_string_<T>;
+
+		// The elements of [first, first + n) can be shuffled through a
+		// temporary buffer without throwing.
+		template<class I>
+		META_CONCEPT __radix_movable =
+			RandomAccessIterator<I> &&
+			Same<iter_reference_t<I>, iter_value_t<I>&> &&
+			std::is_nothrow_move_constructible_v<iter_value_t<I>> &&
+			std::is_nothrow_move_assignable_v<iter_value_t<I>>;
+
+		template<class I, class Proj>
+		META_CONCEPT __radix_sortable =
+			__radix_movable<I> &&
+			(__radix_number_key<__uncvref<indirect_result_t<Proj&, I>>> ||
+			 __radix_string_key<__uncvref<indirect_result_t<Proj&, I>>>);
+
+		// Comp orders keys of type K like < (1) or like > (-1), or
+		// neither (0).
+		template<class Comp, class K>
+		inline constexpr int __radix_direction_ = 0;
+		template<class K>
+		inline constexpr int __radix_direction_<less, K> = 1;
+		template<class K>
+		inline constexpr int __radix_direction_<std::less<K>, K> = 1;
+		template<class K>
+		inline constexpr int __radix_direction_<std::less<>, K> = 1;
+		template<class K>
+		inline constexpr int __radix_direction_<greater, K> = -1;
+		template<class K>
+		inline constexpr int __radix_direction_<std::greater<K>, K> = -1;
+		template<class K>
+		inline constexpr int __radix_direction_<std::greater<>, K> = -1;
+
+		// Whether sort(first, last, comp, proj) can be implemented with
+		// radix_sort_n: 1 for ascending, -1 for descending, 0 for no.
+		template<class I, class Comp, class Proj>
+		constexpr int radix_sort_direction() noexcept {
+			if constexpr (__radix_sortable<I, Proj>) {
+				using K = __uncvref<indirect_result_t<Proj&, I>>;
+				constexpr int dir = __radix_direction_<__uncvref<__unwrap<Comp>>, K>;
+				return dir < 0 && __radix_string_key<K> ? 0 : dir;
+			} else {
+				return 0;
+			}
+		}
+
+		struct __radix_sort_n_fn {
+			// Sorts [first, first + n) by the projected keys, in ascending
+			// order - or descending order, for number keys, if requested.
+			// Returns false without modifying the range if the keys aren't
+			// supported or the scratch space couldn't be allocated.
+			template<RandomAccessIterator I, class Proj>
+			bool operator()(I first, const iter_difference_t<I> n, Proj& proj,
+				bool descending = false) const
+			{
+				STL2_EXPECT(0 <= n);
+				if constexpr (__radix_sortable<I, Proj>) {
+					using key_t = __uncvref<indirect_result_t<Proj&, I>>;
+					if (n < 2) {
+						return true;
+					}
+					if constexpr (__radix_number_key<key_t>) {
+						return lsd(first, n, proj, descending);
+					} else {
+						if (descending) {
+							return false;
+						}
+						buf_t<I> buf{n};
+						if (buf.size() < n) {
+							return false;
+						}
+						msd(first, n, 0, buf.data(), proj);
+						return true;
+					}
+				} else {
+					return false;
+				}
+			}
+
+		private:
+			template<class I>
+			using buf_t = temporary_buffer<iter_value_t<I>>;
+
+			static constexpr int radix_bits = 8;
+			static constexpr std::size_t radix = std::size_t{1} << radix_bits;
+			// Buckets this small are finished by insertion sort.
+			static constexpr std::ptrdiff_t msd_insertion_sort_threshold = 32;
+
+			// Destroys the elements of a fully-populated scratch buffer.
+			template<class T>
+			struct destroy_n_guard {
+				T* first;
+				std::ptrdiff_t n;
+
+				~destroy_n_guard() {
+					for (std::ptrdiff_t i = 0; i < n; ++i) {
+						detail::destruct(first[i]);
+					}
+				}
+			};
+
+			template<class I, class Proj>
+			static bool lsd(I first, const iter_difference_t<I> n, Proj& proj,
+				bool descending)
+			{
+				using T = iter_value_t<I>;
+				using traits = radix_key_traits<__uncvref<indirect_result_t<Proj&, I>>>;
+				using K = typename traits::key_type;
+				constexpr int passes = sizeof(K) * CHAR_BIT / radix_bits;
+				const K flip = descending ? K(~K(0)) : K(0);
+				auto key = [&](auto&& x) {
+					return K(traits::encode(__stl2::invoke(proj, x)) ^ flip);
+				};
+				auto digit = [](K k, int pass) {
+					return static_cast<std::size_t>((k >> (pass * radix_bits)) & (radix - 1));
+				};
+
+				// Histogram every digit in a single pass over the input.
+				std::ptrdiff_t counts[passes][radix] = {};
+				for (iter_difference_t<I> i = 0; i < n; ++i) {
+					const K k = key(first[i]);
+					for (int p = 0; p < passes; ++p) {
+						++counts[p][digit(k, p)];
+					}
+				}
+				// A pass in which every key has the same digit does nothing.
+				bool trivial[passes] = {};
+				int nontrivial_passes = 0;
+				const K k0 = key(first[0]);
+				for (int p = 0; p < passes; ++p) {
+					trivial[p] = counts[p][digit(k0, p)] == n;
+					nontrivial_passes += !trivial[p];
+				}
+				if (nontrivial_passes == 0) {
+					return true;
+				}
+
+				buf_t<I> buf{n};
+				if (buf.size() < n) {
+					return false;
+				}
+				T* const tmp = buf.data();
+
+				// Move the elements into the buffer. For trivially copyable
+				// types this is done by the first pass directly, since there is
+				// nothing to clean up if a projection throws.
+				constexpr bool trivial_t = std::is_trivially_copyable_v<T>;
+				bool in_buffer = false;
+				if constexpr (!trivial_t) {
+					for (iter_difference_t<I> i = 0; i < n; ++i) {
+						detail::construct(tmp[i], iter_move(first + i));
+					}
+					in_buffer = true;
+				}
+				destroy_n_guard<T> guard{tmp, trivial_t ? 0 : n};
+				bool constructed = !trivial_t;
+
+				for (int p = 0; p < passes; ++p) {
+					if (trivial[p]) {
+						continue;
+					}
+					// Convert counts to starting offsets.
+					std::ptrdiff_t sum = 0;
+					for (auto& c : counts[p]) {
+						auto t = c;
+						c = sum;
+						sum += t;
+					}
+					auto& offsets = counts[p];
+					if (in_buffer) {
+						for (iter_difference_t<I> i = 0; i < n; ++i) {
+							const auto d = digit(key(tmp[i]), p);
+							first[offsets[d]++] = std::move(tmp[i]);
+						}
+					} else if (constructed) {
+						for (iter_difference_t<I> i = 0; i < n; ++i) {
+							const auto d = digit(key(first[i]), p);
+							tmp[offsets[d]++] = iter_move(first + i);
+						}
+					} else {
+						for (iter_difference_t<I> i = 0; i < n; ++i) {
+							const auto d = digit(key(first[i]), p);
+							detail::construct(tmp[offsets[d]++], iter_move(first + i));
+						}
+						constructed = true;
+					}
+					in_buffer = !in_buffer;
+				}
+
+				if (in_buffer) {
+					for (iter_difference_t<I> i = 0; i < n; ++i) {
+						first[i] = std::move(tmp[i]);
+					}
+				}
+				return true;
+			}
+
+			template<class I, class Proj>
+			static void msd(I first, iter_difference_t<I> n, std::size_t depth,
+				iter_value_t<I>* const tmp, Proj& proj)
+			{
+				using T = iter_value_t<I>;
+				// Bucket 0 holds the keys that end before depth; bucket
+				// c + 1 those whose byte at depth is c.
+				auto bucket = [&](auto&& x, std::size_t d) -> std::size_t {
+					auto&& key = __stl2::invoke(proj, x);
+					std::string_view s{key};
+					return s.size() > d ? 1 + static_cast<unsigned char>(s[d]) : 0;
+				};
+
+				while (true) {
+					if (n < msd_insertion_sort_threshold) {
+						// All keys share their first depth bytes.
+						auto suffix_less = [depth](auto const& a, auto const& b) {
+							return std::string_view{a}.substr(depth) <
+								std::string_view{b}.substr(depth);
+						};
+						detail::rsort::insertion_sort(first, first + n, suffix_less, proj);
+						return;
+					}
+
+					std::ptrdiff_t counts[radix + 1] = {};
+					for (iter_difference_t<I> i = 0; i < n; ++i) {
+						++counts[bucket(first[i], depth)];
+					}
+					// If every key falls in the same bucket, look at the
+					// next byte without moving anything.
+					const auto b0 = bucket(first[0], depth);
+					if (counts[b0] == n) {
+						if (b0 == 0) {
+							return; // all keys are equal
+						}
+						++depth;
+						continue;
+					}
+
+					std::ptrdiff_t offsets[radix + 1];
+					std::ptrdiff_t sum = 0;
+					for (std::size_t b = 0; b <= radix; ++b) {
+						offsets[b] = sum;
+						sum += counts[b];
+					}
+					{
+						for (iter_difference_t<I> i = 0; i < n; ++i) {
+							detail::construct(tmp[i], iter_move(first + i));
+						}
+						destroy_n_guard<T> guard{tmp, n};
+						for (iter_difference_t<I> i = 0; i < n; ++i) {
+							first[offsets[bucket(tmp[i], depth)]++] = std::move(tmp[i]);
+						}
+					}
+
+					// Bucket 0 holds equal keys; sort the others by the next
+					// byte. Loop on the largest bucket and recurse on the
+					// rest, which are no more than half as large, to bound
+					// the recursion depth by log2(n).
+					std::size_t largest = 1;
+					for (std::size_t b = 2; b <= radix; ++b) {
+						if (counts[b] > counts[largest]) {
+							largest = b;
+						}
+					}
+					std::ptrdiff_t start = counts[0], largest_start = 0;
+					for (std::size_t b = 1; b <= radix; ++b) {
+						if (b == largest) {
+							largest_start = start;
+						} else if (counts[b] > 1) {
+							msd(first + start, counts[b], depth + 1, tmp, proj);
+						}
+						start += counts[b];
+					}
+					first += largest_start;
+					n = counts[largest];
+					++depth;
+				}
+			}
+		};
+
+		inline constexpr __radix_sort_n_fn radix_sort_n {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -26,6 +26,7 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/searcher.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/iterator/counted_iterator.hpp>
 #include <stl2/view/subrange.hpp>
@@ -108,6 +109,19 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyComparable< I1, I2, Pred, Proj1, Proj2>
 		constexpr subrange<I1> operator()(I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = {},
 			Proj1 proj1 = {}, Proj2 proj2 = {}) const {
+			if constexpr (detail::__two_way_searchable<I1, I2, Pred, Proj1, Proj2> &&
+				SizedSentinel<S2, I2>)
+			{
+				const auto m = last2 - first2;
+				iter_difference_t<I1> n = -1;
+				if constexpr (SizedSentinel<S1, I1>) {
+					n = last1 - first1;
+				}
+				if (detail::__use_searcher(n, m)) {
+					return ext::searcher{first2, first2 + m}(
+						std::move(first1), std::move(last1));
+				}
+			}
 			if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2>) {
 				return sized(
 					first1, last1, last1 - first1,
@@ -126,6 +140,19 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyComparable<iterator_t<Rng1>, iterator_t<Rng2>, Pred, Proj1, Proj2>
 		constexpr safe_subrange_t<Rng1> operator()(Rng1&& rng1, Rng2&& rng2, Pred pred = {},
 			Proj1 proj1 = {}, Proj2 proj2 = {}) const {
+			if constexpr (detail::__two_way_searchable<iterator_t<Rng1>,
+				iterator_t<Rng2>, Pred, Proj1, Proj2> && SizedRange<Rng2>)
+			{
+				const auto m = distance(rng2);
+				iter_difference_t<iterator_t<Rng1>> n = -1;
+				if constexpr (SizedRange<Rng1>) {
+					n = distance(rng1);
+				}
+				if (detail::__use_searcher(n, m)) {
+					return ext::searcher{begin(rng2), begin(rng2) + m}(
+						begin(rng1), end(rng1));
+				}
+			}
 			if constexpr (SizedRange<Rng1> && SizedRange<Rng2>) {
 				return sized(
 					begin(rng1), end(rng1), distance(rng1),
@@ -26,6 +26,7 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/iterator/counted_iterator.hpp>
 
@@ -61,6 +62,83 @@ STL2_OPEN_NAMESPACE {
 			return first;
 		}
 
+		// Returns the index of the first run of count elements of the n at
+		// first that satisfy match, or n. Any such run contains one of every
+		// count elements, so those are probed first: a probe that fails skips
+		// count elements, and one that succeeds is extended backward - to no
+		// element already examined - and then forward. Each element is
+		// examined at most once.
+		template<class D, class Match, class Back, class Forward>
+		static constexpr D skip(const D n, const D count, Match& match,
+			Back& back, Forward& forward) {
+			// Elements before lo_bound are examined, or can't start a run.
+			D lo_bound = 0;
+			for (D i = count - 1; i < n;) {
+				if (!match(i)) {
+					lo_bound = i + 1;
+					i += count;
+					continue;
+				}
+				const D lo = i - back(lo_bound, i);
+				const D need = n - lo < count ? n : lo + count;
+				const D hi = i + 1 + forward(i + 1, need);
+				if (hi - lo == count) {
+					return lo;
+				}
+				if (hi == n) {
+					break;
+				}
+				lo_bound = hi + 1;
+				i = hi + count;
+			}
+			return n;
+		}
+
+		template<RandomAccessIterator I, class T, class Pred, class Proj>
+		requires IndirectlyComparable<I, const T*, Pred, Proj>
+		static constexpr iter_difference_t<I> random_access(I first,
+			const iter_difference_t<I> n, const iter_difference_t<I> count,
+			const T& value, Pred& pred, Proj& proj) {
+			using D = iter_difference_t<I>;
+			if constexpr (detail::simd::__contiguous_lanes<I> &&
+				Same<__uncvref<__unwrap<Pred>>, equal_to> &&
+				Same<__uncvref<__unwrap<Proj>>, identity> &&
+				detail::simd::__searchable<iter_value_t<I>, T>)
+			{
+				using V = iter_value_t<I>;
+				const auto v = static_cast<V>(value);
+				if (!detail::is_constant_evaluated() && n >= count && v == value) {
+					const V* const p = std::addressof(*first);
+					auto match = [p, v](const D i) { return p[i] == v; };
+					auto back = [p, v](const D lo, const D i) {
+						return static_cast<D>(detail::simd::count_back(p + lo, i - lo, v));
+					};
+					auto forward = [p, v](const D i, const D end) {
+						return static_cast<D>(detail::simd::find_not(p + i, end - i, v));
+					};
+					return skip(n, count, match, back, forward);
+				}
+			}
+			auto match = [&](const D i) -> bool {
+				return __stl2::invoke(pred, __stl2::invoke(proj, first[i]), value);
+			};
+			auto back = [&](const D lo, D i) {
+				const D end = i;
+				while (i > lo && match(i - 1)) {
+					--i;
+				}
+				return end - i;
+			};
+			auto forward = [&](D i, const D end) {
+				const D start = i;
+				while (i < end && match(i)) {
+					++i;
+				}
+				return i - start;
+			};
+			return skip(n, count, match, back, forward);
+		}
+
 		template<ForwardIterator I, Sentinel<I> S, class T, class Pred, class Proj>
 		requires IndirectlyComparable<I, const T*, Pred, Proj>
 		static constexpr I sized(I first_, S last, iter_difference_t<I> d_,
@@ -69,6 +147,10 @@ STL2_OPEN_NAMESPACE {
 				return first_;
 			}
 
+			if constexpr (RandomAccessIterator<I>) {
+				return first_ + random_access(first_, d_, count, value, pred, proj);
+			}
+
 			auto d = d_;
 			auto first = ext::uncounted(first_);
 
@@ -0,0 +1,369 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SEARCHER_HPP
+#define STL2_DETAIL_ALGORITHM_SEARCHER_HPP
+
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/view/subrange.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// searcher [Extension]
+//
+// A pattern preprocessed for the Two-Way algorithm of Crochemore and
+// Perrin ("Two-way string-matching", JACM 38(3), 1991), which finds the
+// pattern in a text of n elements with fewer than 2n comparisons and
+// constant extra space, reading the text forward only. The pattern is
+// split at a critical factorization into a left and a right half: the
+// right half is compared first, left to right, and a mismatch there
+// shifts the pattern past it; a match of both halves shifts the pattern
+// by its period, and remembers the prefix that is known to match.
+//
+// Patterns of bytes also get the table of shifts of Horspool's variation
+// on Boyer-Moore, after glibc's memmem: in a random access text, the
+// element under the end of the pattern skips up to the pattern's length
+// at a time, without giving up the linear bound.
+//
+// Finding the factorization orders the elements of the pattern, so the
+// patterns are of numbers and enumerations, which are compared with ==
+// and <, and the text with ==.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class T>
+		META_CONCEPT __two_way_element =
+			std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+		template<class T>
+		META_CONCEPT __byte_element = __two_way_element<T> && sizeof(T) == 1;
+
+		// search and find_end hand patterns to searcher when they would
+		// compare the elements with ==.
+		template<class I1, class I2, class Pred, class Proj1, class Proj2>
+		META_CONCEPT __two_way_searchable = RandomAccessIterator<I2> &&
+			__two_way_element<iter_value_t<I2>> &&
+			Same<__uncvref<__unwrap<Pred>>, equal_to> &&
+			Same<__uncvref<__unwrap<Proj1>>, identity> &&
+			Same<__uncvref<__unwrap<Proj2>>, identity>;
+
+		// Shorter patterns aren't worth preprocessing: the naive search
+		// for them is linear too.
+		inline constexpr int two_way_min_size = 3;
+		// ...nor are patterns that fit in few more places than this.
+		inline constexpr int two_way_min_text = 64;
+
+		// Whether to search for the m elements of a pattern with
+		// ext::searcher in a text of n elements, or of unknown length if n
+		// is negative.
+		template<class D1, class D2>
+		constexpr bool __use_searcher(const D1 n, const D2 m) noexcept {
+			return m >= two_way_min_size && (n < 0 || n - m >= two_way_min_text);
+		}
+
+		template<class D>
+		struct two_way_factorization {
+			// The start of the right half of the pattern
+			D suffix;
+			// The shift after both halves match
+			D period;
+			// Whether period is the period of the pattern, so that after a
+			// shift by it the prefix of length size - period still matches
+			bool periodic;
+		};
+
+		// Returns the start of the maximal suffix of the m elements at p,
+		// in the order comp, and sets period to the period of the suffix.
+		template<RandomAccessIterator I, class Comp>
+		constexpr iter_difference_t<I>
+		maximal_suffix(I p, const iter_difference_t<I> m, Comp comp,
+			iter_difference_t<I>& period)
+		{
+			using D = iter_difference_t<I>;
+			D start = -1;
+			D j = 0;
+			D k = 1;
+			D q = 1;
+			while (j + k < m) {
+				auto&& a = p[j + k];
+				auto&& b = p[start + k];
+				if (comp(a, b)) {
+					j += k;
+					k = 1;
+					q = j - start;
+				} else if (a == b) {
+					if (k != q) {
+						++k;
+					} else {
+						j += q;
+						k = 1;
+					}
+				} else {
+					start = j++;
+					k = q = 1;
+				}
+			}
+			period = q;
+			return start + 1;
+		}
+
+		// The critical factorization of the m elements at p: the later of
+		// the starts of the maximal suffixes in the order < and its
+		// reverse.
+		template<RandomAccessIterator I>
+		constexpr two_way_factorization<iter_difference_t<I>>
+		two_way_factorize(I p, const iter_difference_t<I> m)
+		{
+			using D = iter_difference_t<I>;
+			two_way_factorization<D> f{0, 1, true};
+			if (m < 3) {
+				// Either position of a pair is critical.
+				f.suffix = m > 0 ? m - 1 : 0;
+			} else {
+				D q1 = 1;
+				D q2 = 1;
+				const D s1 = maximal_suffix(p, m, less{}, q1);
+				const D s2 = maximal_suffix(p, m, greater{}, q2);
+				if (s1 > s2) {
+					f.suffix = s1;
+					f.period = q1;
+				} else {
+					f.suffix = s2;
+					f.period = q2;
+				}
+			}
+			STL2_EXPECT(f.suffix + f.period <= m || m == 0);
+			for (D i = 0; i < f.suffix; ++i) {
+				if (!(p[i] == p[i + f.period])) {
+					// The left half does not recur a period later: any shift
+					// less than the longer half would mismatch.
+					f.periodic = false;
+					f.period = (f.suffix < m - f.suffix ? m - f.suffix : f.suffix) + 1;
+					break;
+				}
+			}
+			return f;
+		}
+
+		// Returns the first occurrence in [first, last) of the m elements at
+		// p, factored by f - or the last, if find_last - or {last, last}.
+		// The search for the last goes on past each match as past a
+		// mismatch in the left half, so it still reads the text once.
+		template<ForwardIterator I1, Sentinel<I1> S1, RandomAccessIterator I2>
+		requires IndirectlyComparable<I1, I2, equal_to>
+		constexpr subrange<I1> two_way_search(I1 first, S1 last, I2 p,
+			const iter_difference_t<I2> m,
+			const two_way_factorization<iter_difference_t<I2>>& f,
+			const bool find_last = false)
+		{
+			using D1 = iter_difference_t<I1>;
+			using D = iter_difference_t<I2>;
+			// The window of the text under the pattern is [first, wend), and
+			// the right half of the pattern is over [mid, wend).
+			auto wend = first;
+			if (advance(wend, static_cast<D1>(m), last) != 0) {
+				return {wend, wend};
+			}
+			auto mid = next(first, static_cast<D1>(f.suffix));
+			// The length of the prefix of the window known to match, and
+			// the end of that prefix
+			D memory = 0;
+			auto resume = wend;
+			// The last occurrence found so far, if find_last
+			bool found = false;
+			subrange<I1> match{};
+			for (;;) {
+				D i = f.suffix;
+				auto t = mid;
+				if (memory > f.suffix) {
+					i = memory;
+					t = resume;
+				}
+				while (i < m && *t == p[i]) {
+					++i;
+					++t;
+				}
+				D shift = f.period;
+				if (i == m) {
+					// The left half, in any order: a mismatch anywhere in it
+					// shifts by the period.
+					D l = memory;
+					if (l < f.suffix) {
+						auto u = next(first, static_cast<D1>(l));
+						while (l < f.suffix && *u == p[l]) {
+							++l;
+							++u;
+						}
+					}
+					if (l >= f.suffix) {
+						if (!find_last) {
+							return {std::move(first), std::move(t)};
+						}
+						found = true;
+						match = {first, t};
+					}
+					if (f.periodic) {
+						memory = m - f.period;
+						resume = std::move(t);
+					}
+				} else {
+					shift = i - f.suffix + 1;
+					memory = 0;
+				}
+				if (advance(wend, static_cast<D1>(shift), last) != 0) {
+					if (found) {
+						return match;
+					}
+					return {wend, wend};
+				}
+				advance(first, static_cast<D1>(shift));
+				advance(mid, static_cast<D1>(shift));
+			}
+		}
+
+		// As two_way_search, over the n elements of a random access text,
+		// shifting by table[x] when x is the last element of the window.
+		template<RandomAccessIterator I1, RandomAccessIterator I2>
+		requires IndirectlyComparable<I1, I2, equal_to> &&
+			__byte_element<iter_value_t<I1>>
+		constexpr subrange<I1> two_way_skip_search(I1 first,
+			const iter_difference_t<I1> n, I2 p, const iter_difference_t<I2> m,
+			const two_way_factorization<iter_difference_t<I2>>& f,
+			const iter_difference_t<I2> (&table)[256])
+		{
+			using D1 = iter_difference_t<I1>;
+			using D = iter_difference_t<I2>;
+			D1 j = 0;
+			D memory = 0;
+			while (j <= n - m) {
+				const auto w = first + j;
+				auto shift = table[static_cast<unsigned char>(iter_value_t<I1>(w[m - 1]))];
+				if (shift != 0) {
+					// A periodic pattern whose last period mismatched can't
+					// match before the end of that period.
+					if (memory != 0 && shift < f.period) {
+						shift = m - f.period;
+					}
+					memory = 0;
+					j += shift;
+					continue;
+				}
+				// The last element matched, by the table.
+				D i = f.suffix < memory ? memory : f.suffix;
+				while (i < m - 1 && w[i] == p[i]) {
+					++i;
+				}
+				if (i >= m - 1) {
+					D l = memory;
+					while (l < f.suffix && w[l] == p[l]) {
+						++l;
+					}
+					if (l >= f.suffix) {
+						return {w, w + m};
+					}
+					j += f.period;
+					if (f.periodic) {
+						memory = m - f.period;
+					}
+				} else {
+					j += i - f.suffix + 1;
+					memory = 0;
+				}
+			}
+			const auto end = first + n;
+			return {end, end};
+		}
+
+		template<class D, bool>
+		struct __shift_table {};
+		template<class D>
+		struct __shift_table<D, true> {
+			D shift_[256] = {};
+		};
+	}
+
+	namespace ext {
+		template<RandomAccessIterator I>
+		requires detail::__two_way_element<iter_value_t<I>>
+		class searcher
+		: private detail::__shift_table<iter_difference_t<I>,
+			detail::__byte_element<iter_value_t<I>>>
+		{
+			using D = iter_difference_t<I>;
+			static constexpr bool bytes = detail::__byte_element<iter_value_t<I>>;
+
+			I pattern_{};
+			D size_ = 0;
+			detail::two_way_factorization<D> factors_{0, 1, true};
+		public:
+			searcher() = default;
+
+			template<SizedSentinel<I> S>
+			constexpr searcher(I first, S last)
+			: pattern_{std::move(first)}, size_{last - pattern_}
+			, factors_{detail::two_way_factorize(pattern_, size_)}
+			{
+				if constexpr (bytes) {
+					for (auto& s : this->shift_) {
+						s = size_;
+					}
+					for (D i = 0; i < size_; ++i) {
+						this->shift_[static_cast<unsigned char>(iter_value_t<I>(pattern_[i]))] =
+							size_ - i - 1;
+					}
+				}
+			}
+
+			template<_ForwardingRange R>
+			requires SizedRange<R> && Same<iterator_t<R>, I>
+			constexpr explicit searcher(R&& r)
+			: searcher{begin(r), begin(r) + distance(r)} {}
+
+			// Returns the first occurrence of the pattern in [first, last),
+			// or {last, last}.
+			template<ForwardIterator I1, Sentinel<I1> S1>
+			requires IndirectlyComparable<I1, I, equal_to>
+			constexpr subrange<I1> operator()(I1 first, S1 last) const
+			{
+				if (size_ == 0) {
+					return {first, first};
+				}
+				if constexpr (bytes && RandomAccessIterator<I1> &&
+					SizedSentinel<S1, I1> && Same<iter_value_t<I1>, iter_value_t<I>>)
+				{
+					return detail::two_way_skip_search(first, last - first,
+						pattern_, size_, factors_, this->shift_);
+				} else {
+					return detail::two_way_search(std::move(first),
+						std::move(last), pattern_, size_, factors_);
+				}
+			}
+
+			template<ForwardRange R>
+			requires IndirectlyComparable<iterator_t<R>, I, equal_to>
+			constexpr safe_subrange_t<R> operator()(R&& r) const
+			{
+				return (*this)(begin(r), end(r));
+			}
+		};
+
+		template<RandomAccessIterator I, SizedSentinel<I> S>
+		searcher(I, S) -> searcher<I>;
+
+		template<_ForwardingRange R>
+		requires SizedRange<R>
+		searcher(R&&) -> searcher<iterator_t<R>>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -18,6 +18,7 @@
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // set_difference [set.difference]
@@ -66,6 +67,52 @@ STL2_OPEN_NAMESPACE {
 				std::move(result),
 				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
 		}
+
+		// Extension: set_difference with an execution policy.
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I1, Sentinel<I1> S1,
+			RandomAccessIterator I2, Sentinel<I2> S2, RandomAccessIterator O,
+			class Comp = less, class Proj1 = identity, class Proj2 = identity>
+		requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+		set_difference_result<I1, O>
+		operator()(EP&&, I1 first1, S1 sent1, I2 first2, S2 sent2, O result,
+			Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
+		{
+			auto last1 = next(first1, std::move(sent1));
+			auto last2 = next(first2, std::move(sent2));
+			if constexpr (ext::__parallel_policy<EP>) {
+				auto out = parallel_set_difference(first1,
+					iter_difference_t<I1>(last1 - first1), first2,
+					iter_difference_t<I2>(last2 - first2), std::move(result),
+					comp, proj1, proj2);
+				return {std::move(last1), std::move(out)};
+			}
+			return (*this)(std::move(first1), std::move(last1), std::move(first2),
+				std::move(last2), std::move(result), __stl2::ref(comp),
+				__stl2::ref(proj1), __stl2::ref(proj2));
+		}
+
+		// Extension: set_difference with an execution policy.
+		template<ext::ExecutionPolicy EP, RandomAccessRange R1, RandomAccessRange R2,
+			RandomAccessIterator O, class Comp = less, class Proj1 = identity,
+			class Proj2 = identity>
+		requires Mergeable<iterator_t<R1>, iterator_t<R2>, O, Comp, Proj1, Proj2>
+		set_difference_result<safe_iterator_t<R1>, O>
+		operator()(EP&& ep, R1&& r1, R2&& r2, O result, Comp comp = {},
+			Proj1 proj1 = {}, Proj2 proj2 = {}) const
+		{
+			return (*this)(std::forward<EP>(ep), begin(r1), end(r1), begin(r2), end(r2),
+				std::move(result), __stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
+		}
+
+	private:
+		// set_difference on the tasks of the thread pool, defined in
+		// <stl2/execution.hpp>.
+		template<RandomAccessIterator I1, RandomAccessIterator I2,
+			RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+		requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+		static O parallel_set_difference(I1 first1, iter_difference_t<I1> n1,
+			I2 first2, iter_difference_t<I2> n2, O result,
+			Comp& comp, Proj1& proj1, Proj2& proj2);
 	};
 
 	inline constexpr __set_difference_fn set_difference {};
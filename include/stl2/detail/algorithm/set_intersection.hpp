@@ -16,11 +16,18 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/gallop.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // set_intersection [set.intersection]
 //
+// Over random access inputs of known size, gallops through long runs of
+// either input that go before the next element of the other: intersecting
+// m elements with n takes O(m log(n / m)) comparisons, rather than
+// O(m + n).
+//
 STL2_OPEN_NAMESPACE {
 	template<class I1, class I2, class O>
 	using set_intersection_result = __in_in_out_result<I1, I2, O>;
@@ -33,6 +40,47 @@ STL2_OPEN_NAMESPACE {
 		operator()(I1 first1, S1 last1, I2 first2, S2 last2, O result,
 			Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
+			if constexpr (RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+				RandomAccessIterator<I2> && SizedSentinel<S2, I2>)
+			{
+				const auto n1 = iter_difference_t<I1>(last1 - first1);
+				const auto n2 = iter_difference_t<I2>(last2 - first2);
+				auto i = iter_difference_t<I1>(0);
+				auto j = iter_difference_t<I2>(0);
+				// The consecutive elements of each input that went before
+				// the next element of the other
+				int run1 = 0;
+				int run2 = 0;
+				while (i < n1 && j < n2) {
+					iter_reference_t<I1>&& v1 = first1[i];
+					iter_reference_t<I2>&& v2 = first2[j];
+					auto&& p1 = __stl2::invoke(proj1, v1);
+					auto&& p2 = __stl2::invoke(proj2, v2);
+					if (__stl2::invoke(comp, p1, p2)) {
+						++i;
+						run2 = 0;
+						if (++run1 == detail::min_gallop) {
+							i += detail::gallop_before(first1 + i, n1 - i, p2, comp, proj1);
+							run1 = 0;
+						}
+					} else if (__stl2::invoke(comp, p2, p1)) {
+						++j;
+						run1 = 0;
+						if (++run2 == detail::min_gallop) {
+							j += detail::gallop_before(first2 + j, n2 - j, p1, comp, proj2);
+							run2 = 0;
+						}
+					} else {
+						*result = std::forward<iter_reference_t<I1>>(v1);
+						++result;
+						++i;
+						++j;
+						run1 = 0;
+						run2 = 0;
+					}
+				}
+				return {first1 + i, first2 + j, std::move(result)};
+			}
 			while (first1 != last1 && first2 != last2) {
 				iter_reference_t<I1>&& v1 = *first1;
 				iter_reference_t<I2>&& v2 = *first2;
@@ -61,6 +109,54 @@ STL2_OPEN_NAMESPACE {
 			return (*this)(begin(r1), end(r1), begin(r2), end(r2), std::move(result),
 				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
 		}
+
+		// Extension: set_intersection with an execution policy. Returns
+		// the ends of both inputs, which the tasks consume whole.
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I1, Sentinel<I1> S1,
+			RandomAccessIterator I2, Sentinel<I2> S2, RandomAccessIterator O,
+			class Comp = less, class Proj1 = identity, class Proj2 = identity>
+		requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+		set_intersection_result<I1, I2, O>
+		operator()(EP&&, I1 first1, S1 sent1, I2 first2, S2 sent2, O result,
+			Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
+		{
+			auto last1 = next(first1, std::move(sent1));
+			auto last2 = next(first2, std::move(sent2));
+			if constexpr (ext::__parallel_policy<EP>) {
+				auto out = parallel_set_intersection(first1,
+					iter_difference_t<I1>(last1 - first1), first2,
+					iter_difference_t<I2>(last2 - first2), std::move(result),
+					comp, proj1, proj2);
+				return {std::move(last1), std::move(last2), std::move(out)};
+			}
+			auto out = (*this)(std::move(first1), last1, std::move(first2), last2,
+				std::move(result), __stl2::ref(comp), __stl2::ref(proj1),
+				__stl2::ref(proj2)).out;
+			return {std::move(last1), std::move(last2), std::move(out)};
+		}
+
+		// Extension: set_intersection with an execution policy.
+		template<ext::ExecutionPolicy EP, RandomAccessRange R1, RandomAccessRange R2,
+			RandomAccessIterator O, class Comp = less, class Proj1 = identity,
+			class Proj2 = identity>
+		requires Mergeable<iterator_t<R1>, iterator_t<R2>, O, Comp, Proj1, Proj2>
+		set_intersection_result<safe_iterator_t<R1>, safe_iterator_t<R2>, O>
+		operator()(EP&& ep, R1&& r1, R2&& r2, O result, Comp comp = {},
+			Proj1 proj1 = {}, Proj2 proj2 = {}) const
+		{
+			return (*this)(std::forward<EP>(ep), begin(r1), end(r1), begin(r2), end(r2),
+				std::move(result), __stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
+		}
+
+	private:
+		// set_intersection on the tasks of the thread pool, defined in
+		// <stl2/execution.hpp>.
+		template<RandomAccessIterator I1, RandomAccessIterator I2,
+			RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+		requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+		static O parallel_set_intersection(I1 first1, iter_difference_t<I1> n1,
+			I2 first2, iter_difference_t<I2> n2, O result,
+			Comp& comp, Proj1& proj1, Proj2& proj2);
 	};
 
 	inline constexpr __set_intersection_fn set_intersection {};
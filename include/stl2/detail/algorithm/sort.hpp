@@ -17,8 +17,17 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/forward_sort.hpp>
+#include <stl2/detail/algorithm/make_heap.hpp>
+#include <stl2/detail/algorithm/pdq_partition.hpp>
+#include <stl2/detail/algorithm/radix_sort_n.hpp>
 #include <stl2/detail/algorithm/random_access_sort.hpp>
+#include <stl2/detail/algorithm/sort_heap.hpp>
+#include <stl2/detail/algorithm/sorting_network.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/concepts.hpp>
+#include <stl2/detail/span.hpp>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -27,94 +36,241 @@
 STL2_OPEN_NAMESPACE {
 	struct __sort_fn : private __niebloid {
 	private:
-		static constexpr std::ptrdiff_t introsort_threshold = 16;
+		// Pattern-defeating quicksort (pdqsort), after Orson Peters
+		// https://github.com/orlp/pdqsort
+
+		// Partitions below this size are sorted by insertion sort, or by a
+		// sorting network when the elements are integers.
+		static constexpr std::ptrdiff_t insertion_sort_threshold = 24;
+		// Ranges at least this long with suitable keys are radix sorted...
+		static constexpr std::ptrdiff_t radix_sort_threshold = 1024;
+		// ...but ranges with number keys wider than 32 bits only up to this
+		// length: beyond it the eight scatter passes lose to pdqsort.
+		static constexpr std::ptrdiff_t wide_radix_sort_limit = std::ptrdiff_t{1} << 17;
+		// Adjacent pairs sampled to decide whether to leave a range to pdqsort.
+		static constexpr std::ptrdiff_t presorted_samples = 64;
+		// When we detect an already partitioned partition we attempt an
+		// insertion sort that gives up after this many element moves.
+		static constexpr std::ptrdiff_t partial_insertion_sort_limit = 8;
 
 		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
-		static constexpr I choose_pivot(I first, I last, Comp& comp, Proj& proj)
+		static constexpr void unguarded_insertion_sort(I first, I last, Comp& comp, Proj& proj)
 		{
-			STL2_EXPECT(first != last);
-			I mid = first + iter_difference_t<I>(last - first) / 2;
-			--last;
-			// Find the median:
-			return [&](auto&& a, auto&& b, auto&& c) {
-				return __stl2::invoke(comp, a, b)
-					? (__stl2::invoke(comp, b, c) ? mid   : (__stl2::invoke(comp, a, c) ? last : first))
-					: (__stl2::invoke(comp, a, c) ? first : (__stl2::invoke(comp, b, c) ? last : mid  ));
-			}(__stl2::invoke(proj, *first), __stl2::invoke(proj, *mid), __stl2::invoke(proj, *last));
+			// Precondition: *prev(first) is a lower bound for [first, last)
+			for (I i = first; i != last; ++i) {
+				if (__stl2::invoke(comp, __stl2::invoke(proj, *i), __stl2::invoke(proj, *prev(i)))) {
+					detail::rsort::unguarded_linear_insert(i, iter_move(i), comp, proj);
+				}
+			}
 		}
 
+		// Insertion sort [first, last), giving up and returning false if more
+		// than partial_insertion_sort_limit elements must be moved.
 		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
-		static constexpr I unguarded_partition(I first, I last, Comp& comp, Proj& proj)
+		static constexpr bool partial_insertion_sort(I first, I last, Comp& comp, Proj& proj)
 		{
-			I pivot_pnt = choose_pivot(first, last, comp, proj);
-
-			// Do the partition:
-			while (true) {
-				auto&& v = *pivot_pnt;
-				auto&& pivot = __stl2::invoke(proj, std::forward<decltype(v)>(v));
-				while (__stl2::invoke(comp, __stl2::invoke(proj, *first), pivot)) {
-					++first;
-				}
-				while (__stl2::invoke(comp, pivot, __stl2::invoke(proj, *--last))) {
-					; // do nothing
-				}
-				if (!(first < last)) {
-					return first;
+			if (first == last) {
+				return true;
+			}
+			iter_difference_t<I> moves = 0;
+			for (I i = next(first); i != last; ++i) {
+				I sift = i;
+				I sift_1 = prev(i);
+				if (__stl2::invoke(comp, __stl2::invoke(proj, *sift), __stl2::invoke(proj, *sift_1))) {
+					iter_value_t<I> tmp = iter_move(sift);
+					do {
+						*sift = iter_move(sift_1);
+						--sift;
+					} while (sift != first &&
+						__stl2::invoke(comp, __stl2::invoke(proj, tmp), __stl2::invoke(proj, *--sift_1)));
+					*sift = std::move(tmp);
+					moves += i - sift;
+					if (moves > partial_insertion_sort_limit) {
+						return false;
+					}
 				}
-				iter_swap(first, last);
-				pivot_pnt = pivot_pnt == first ? last : (pivot_pnt == last ? first : pivot_pnt);
-				++first;
 			}
+			return true;
 		}
 
-		template<RandomAccessIterator I, class Comp, class Proj>
-		requires Sortable<I, Comp, Proj>
-		static constexpr void
-		introsort_loop(I first, I last, iter_difference_t<I> depth_limit, Comp& comp, Proj& proj)
+		// Swaps a few pseudo-randomly chosen elements into the middle of
+		// [first, last) to break up patterns that caused an unbalanced
+		// partition.
+		template<RandomAccessIterator I>
+		requires Permutable<I>
+		static constexpr void break_patterns(I first, I last)
 		{
-			while (distance(first, last) > introsort_threshold) {
-				if (depth_limit == 0) {
-					partial_sort(first, last, last, __stl2::ref(comp), __stl2::ref(proj));
-					return;
+			const auto n = iter_difference_t<I>(last - first);
+			if (n < 8) {
+				return;
+			}
+			// xorshift64, seeded with the length so that results are reproducible
+			std::uint64_t seed = static_cast<std::uint64_t>(n);
+			auto const gen = [&seed] {
+				seed ^= seed << 13;
+				seed ^= seed >> 7;
+				seed ^= seed << 17;
+				return seed;
+			};
+			std::uint64_t mask = 1;
+			while (mask < static_cast<std::uint64_t>(n)) {
+				mask <<= 1;
+			}
+			--mask;
+			const auto pos = n / 4 * 2;
+			for (int k = 0; k < 3; ++k) {
+				auto other = static_cast<iter_difference_t<I>>(gen() & mask);
+				if (other >= n) {
+					other -= n;
 				}
-				I cut = unguarded_partition(first, last, comp, proj);
-				introsort_loop(cut, last, --depth_limit, comp, proj);
-				last = cut;
+				iter_swap(first + (pos - 1 + k), first + other);
 			}
 		}
 
-		template<BidirectionalIterator I, class Comp, class Proj>
+		// True if evenly spaced adjacent pairs of [first, first + n) are all
+		// in order or all in reverse order. pdqsort handles such inputs in
+		// (nearly) linear time, which radix sort cannot match.
+		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
-		static constexpr void unguarded_insertion_sort(I first, I last, Comp& comp, Proj& proj)
+		static constexpr bool looks_presorted(I first, const iter_difference_t<I> n,
+			Comp& comp, Proj& proj)
 		{
-			for (I i = first; i != last; ++i) {
-				detail::rsort::unguarded_linear_insert(i, iter_move(i), comp, proj);
+			const auto stride = (n - 1) / presorted_samples;
+			bool ascending = true;
+			bool descending = true;
+			for (auto i = iter_difference_t<I>(0); i + 1 < n; i += stride) {
+				auto&& a = __stl2::invoke(proj, first[i]);
+				auto&& b = __stl2::invoke(proj, first[i + 1]);
+				ascending = ascending && !__stl2::invoke(comp, b, a);
+				descending = descending && !__stl2::invoke(comp, a, b);
+				if (!ascending && !descending) {
+					return false;
+				}
 			}
+			return true;
 		}
 
 		template<RandomAccessIterator I, class Comp, class Proj>
 		requires Sortable<I, Comp, Proj>
-		static constexpr void final_insertion_sort(I first, I last, Comp &comp, Proj &proj)
+		static constexpr void pdqsort_loop(I first, I last, int bad_allowed,
+			bool leftmost, Comp& comp, Proj& proj)
 		{
-			if (distance(first, last) > introsort_threshold) {
-				detail::rsort::insertion_sort(first, first + introsort_threshold, comp, proj);
-				unguarded_insertion_sort(first + introsort_threshold, last, comp, proj);
-			} else {
-				detail::rsort::insertion_sort(first, last, comp, proj);
+			while (true) {
+				const auto n = iter_difference_t<I>(last - first);
+				if (n < insertion_sort_threshold) {
+					// Floating-point networks only pay for themselves with
+					// vector blends, which baseline x86-64 lacks.
+					if constexpr (detail::__branchless_exchangeable<I, Comp, Proj> &&
+						std::is_integral_v<iter_value_t<I>>) {
+						detail::network_sort_fn::sort_up_to<
+							insertion_sort_threshold - 1>(first, n, comp, proj);
+					} else if (leftmost) {
+						detail::rsort::insertion_sort(first, last, comp, proj);
+					} else {
+						unguarded_insertion_sort(first, last, comp, proj);
+					}
+					return;
+				}
+
+				detail::pdq_partition::choose_pivot(first, last, comp, proj);
+
+				// If the pivot is equivalent to the element before this
+				// partition - which bounds it from below - there are no
+				// elements less than the pivot in this partition. Put all
+				// elements equivalent to the pivot in place in one pass.
+				if (!leftmost && !__stl2::invoke(comp,
+					__stl2::invoke(proj, *prev(first)), __stl2::invoke(proj, *first)))
+				{
+					first = next(detail::pdq_partition::left(first, last, comp, proj));
+					continue;
+				}
+
+				auto [pivot_pos, already_partitioned] =
+					detail::pdq_partition::right(first, last, comp, proj);
+				const auto l_size = iter_difference_t<I>(pivot_pos - first);
+				const auto r_size = iter_difference_t<I>(last - next(pivot_pos));
+
+				if (l_size < n / 8 || r_size < n / 8) {
+					// Unbalanced partition: after too many of these, fall back
+					// to heapsort for guaranteed O(n log n).
+					if (--bad_allowed == 0) {
+						__stl2::make_heap(first, last, __stl2::ref(comp), __stl2::ref(proj));
+						__stl2::sort_heap(first, last, __stl2::ref(comp), __stl2::ref(proj));
+						return;
+					}
+					break_patterns(first, pivot_pos);
+					break_patterns(next(pivot_pos), last);
+				} else if (already_partitioned &&
+					partial_insertion_sort(first, pivot_pos, comp, proj) &&
+					partial_insertion_sort(next(pivot_pos), last, comp, proj))
+				{
+					// The input was - or was very nearly - already sorted.
+					return;
+				}
+
+				// Recurse into the left partition, loop on the right.
+				pdqsort_loop(first, pivot_pos, bad_allowed, leftmost, comp, proj);
+				first = next(pivot_pos);
+				leftmost = false;
 			}
 		}
 
 		template<Integral I>
-		static constexpr auto log2(I n) {
+		static constexpr int log2(I n) {
 			STL2_EXPECT(n > 0);
-			I k = 0;
+			int k = 0;
 			for (; n != 1; n /= 2) {
 				++k;
 			}
 			return k;
 		}
+		template<RandomAccessIterator I, class Comp, class Proj>
+		requires Sortable<I, Comp, Proj>
+		static constexpr void sort_random_access(I first, I last, Comp& comp, Proj& proj)
+		{
+			if (first == last) {
+				return;
+			}
+			const auto n = iter_difference_t<I>(last - first);
+			constexpr int radix_direction = detail::radix_sort_direction<I, Comp, Proj>();
+			if constexpr (radix_direction != 0) {
+				using K = __uncvref<indirect_result_t<Proj&, I>>;
+				constexpr bool wide = detail::__radix_number_key<K> && sizeof(K) > 4;
+				if (n >= radix_sort_threshold && (!wide || n <= wide_radix_sort_limit) &&
+					!detail::is_constant_evaluated() &&
+					!looks_presorted(first, n, comp, proj) &&
+					detail::radix_sort_n(first, n, proj, radix_direction < 0))
+				{
+					return;
+				}
+			}
+			pdqsort_loop(first, last, log2(n), true, comp, proj);
+		}
+
+		// Parallel sort: quicksort whose partitioning steps are themselves
+		// split across tasks. Ranges no longer than this are sorted by a
+		// single task. <stl2/execution.hpp> defines the functions below.
+		static constexpr std::ptrdiff_t parallel_sort_grain = std::ptrdiff_t{1} << 15;
+
+		// Partitions [first, last) by pred with up to chunks tasks: each
+		// partitions one block, after which the elements on the wrong side
+		// of the overall partition point are swapped into place pairwise.
+		template<RandomAccessIterator I, class Pred, class Proj>
+		requires Permutable<I>
+		static I parallel_partition(I first, I last, Pred& pred, Proj& proj,
+			std::ptrdiff_t chunks);
+
+		template<RandomAccessIterator I, class Comp, class Proj>
+		requires Sortable<I, Comp, Proj>
+		static void parallel_sort_loop(I first, I last, int bad_allowed,
+			std::ptrdiff_t chunks, Comp& comp, Proj& proj);
+
+		template<RandomAccessIterator I, class Comp, class Proj>
+		requires Sortable<I, Comp, Proj>
+		static void parallel_sort(I first, I last, Comp& comp, Proj& proj);
+
 	public:
 		/// Extension: sort using forward iterators
 		///
@@ -123,13 +279,8 @@ STL2_OPEN_NAMESPACE {
 		constexpr I operator()(I first, S sent, Comp comp = {}, Proj proj = {}) const
 		{
 			if constexpr (RandomAccessIterator<I>) {
-				if (first == sent) {
-					return first;
-				}
 				auto last = next(first, std::move(sent));
-				auto n = distance(first, last);
-				introsort_loop(first, last, log2(n) * 2, comp, proj);
-				final_insertion_sort(first, last, comp, proj);
+				sort_random_access(first, last, comp, proj);
 				return last;
 			}
 			else {
@@ -144,8 +295,47 @@ STL2_OPEN_NAMESPACE {
 		requires Sortable<iterator_t<R>, Comp, Proj>
 		constexpr safe_iterator_t<R> operator()(R&& r, Comp comp = {}, Proj proj = {}) const
 		{
+			if constexpr (ext::__span::has_static_extent<R>) {
+				// The length is known at compile time: sort small ranges
+				// with a fixed sorting network.
+				constexpr auto n = ext::__span::static_extent<R>::value;
+				if constexpr (n <= detail::max_network_sort_size) {
+					detail::network_sort_fn::sort<std::size_t(n)>(begin(r), comp, proj);
+					return end(r);
+				}
+			}
 			return (*this)(begin(r), end(r), std::move(comp), std::move(proj));
 		}
+
+		/// Extension: sort with an execution policy
+		///
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, Sentinel<I> S,
+			class Comp = less, class Proj = identity>
+		requires Sortable<I, Comp, Proj>
+		I operator()(EP&&, I first, S sent, Comp comp = {}, Proj proj = {}) const
+		{
+			auto last = next(first, std::move(sent));
+			if constexpr (ext::__parallel_policy<EP>) {
+				const auto n = iter_difference_t<I>(last - first);
+				if (n > parallel_sort_grain) {
+					parallel_sort(first, last, comp, proj);
+					return last;
+				}
+			}
+			sort_random_access(first, last, comp, proj);
+			return last;
+		}
+
+		/// Extension: sort with an execution policy
+		///
+		template<ext::ExecutionPolicy EP, RandomAccessRange R, class Comp = less,
+			class Proj = identity>
+		requires Sortable<iterator_t<R>, Comp, Proj>
+		safe_iterator_t<R> operator()(EP&& ep, R&& r, Comp comp = {}, Proj proj = {}) const
+		{
+			return (*this)(std::forward<EP>(ep), begin(r), end(r),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
 	};
 
 	inline constexpr __sort_fn sort {};
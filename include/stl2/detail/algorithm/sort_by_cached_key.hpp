@@ -0,0 +1,97 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SORT_BY_CACHED_KEY_HPP
+#define STL2_DETAIL_ALGORITHM_SORT_BY_CACHED_KEY_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/apply_permutation.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// sort_by_cached_key [Extension]
+//
+// Stably sorts by a projected key, evaluating the projection exactly once
+// per element (the "Schwartzian transform"): (key, position) pairs are
+// sorted in a temporary buffer, then the elements are permuted into place
+// by following the cycles of the permutation. Worthwhile when the
+// projection is expensive; falls back to stable_sort when no buffer is
+// available.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I, class Comp, class Proj>
+		META_CONCEPT __cacheable_key =
+			Sortable<I, Comp, Proj> &&
+			Movable<__uncvref<indirect_result_t<Proj&, I>>> &&
+			Constructible<__uncvref<indirect_result_t<Proj&, I>>,
+				indirect_result_t<Proj&, I>> &&
+			IndirectStrictWeakOrder<Comp, __uncvref<indirect_result_t<Proj&, I>>*>;
+
+		struct __sort_by_cached_key_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Proj,
+				class Comp = less>
+			requires __cacheable_key<I, Comp, Proj>
+			I operator()(I first, S sent, Proj proj, Comp comp = {}) const
+			{
+				using K = __uncvref<indirect_result_t<Proj&, I>>;
+				using D = iter_difference_t<I>;
+				struct entry {
+					K key;
+					D index;
+				};
+
+				auto last = next(first, std::move(sent));
+				const auto n = D(last - first);
+				if (n < 2) {
+					return last;
+				}
+				detail::temporary_buffer<entry> buf{n};
+				if (buf.size() < n) {
+					__stl2::stable_sort(first, last,
+						__stl2::ref(comp), __stl2::ref(proj));
+					return last;
+				}
+				auto vec = detail::make_temporary_vector(buf);
+				for (D i = 0; i < n; ++i) {
+					vec.emplace_back(entry{
+						K(__stl2::invoke(proj, *(first + i))), i});
+				}
+				// Ties are broken by position, so the sort is stable.
+				__stl2::sort(vec, [&comp](const entry& x, const entry& y) {
+					if (__stl2::invoke(comp, x.key, y.key)) return true;
+					if (__stl2::invoke(comp, y.key, x.key)) return false;
+					return x.index < y.index;
+				});
+				detail::permute_by_gather(first, n, [&vec](D j) {
+					const D k = vec[j].index;
+					vec[j].index = j;
+					return k;
+				});
+				return last;
+			}
+
+			template<RandomAccessRange R, class Proj, class Comp = less>
+			requires __cacheable_key<iterator_t<R>, Comp, Proj>
+			safe_iterator_t<R> operator()(R&& r, Proj proj, Comp comp = {}) const
+			{
+				return (*this)(begin(r), end(r), __stl2::ref(proj), __stl2::ref(comp));
+			}
+		};
+
+		inline constexpr __sort_by_cached_key_fn sort_by_cached_key {};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
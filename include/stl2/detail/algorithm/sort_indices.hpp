@@ -0,0 +1,108 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SORT_INDICES_HPP
+#define STL2_DETAIL_ALGORITHM_SORT_INDICES_HPP
+
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/partial_sort.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// sort_indices, stable_sort_indices, partial_sort_indices [Extension]
+//
+// Compute the permutation that would sort [first, last) - the positions
+// of its elements in sorted order - without moving the elements. Pair
+// with apply_permutation to rearrange one or more ranges with one move
+// per element, which pays off when elements are expensive to move.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I, class Proj>
+		struct __index_projection {
+			I first;
+			Proj& proj;
+
+			constexpr decltype(auto) operator()(const iter_difference_t<I> i) const {
+				return __stl2::invoke(proj, *(first + i));
+			}
+		};
+
+		template<class D>
+		std::vector<D> __identity_permutation(const D n) {
+			std::vector<D> indices(static_cast<std::size_t>(n));
+			for (D i = 0; i < n; ++i) {
+				indices[i] = i;
+			}
+			return indices;
+		}
+
+		template<class Sort>
+		struct __sort_indices_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<I, Proj>>
+			std::vector<iter_difference_t<I>>
+			operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
+			{
+				auto indices = __identity_permutation(distance(first, std::move(last)));
+				Sort{}(indices, __stl2::ref(comp), __index_projection<I, Proj>{first, proj});
+				return indices;
+			}
+
+			template<RandomAccessRange R, class Comp = less, class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<iterator_t<R>, Proj>>
+			std::vector<iter_difference_t<iterator_t<R>>>
+			operator()(R&& r, Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(r), end(r), __stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __sort_indices_fn<__sort_fn> sort_indices {};
+		inline constexpr __sort_indices_fn<__stable_sort_fn> stable_sort_indices {};
+
+		// Only the first k positions are in order; the rest are in
+		// unspecified order.
+		struct __partial_sort_indices_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<I, Proj>>
+			std::vector<iter_difference_t<I>>
+			operator()(I first, S last, const iter_difference_t<I> k,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				auto indices = __identity_permutation(distance(first, std::move(last)));
+				STL2_EXPECT(0 <= k && k <= iter_difference_t<I>(indices.size()));
+				__stl2::partial_sort(indices.begin(), indices.begin() + k, indices.end(),
+					__stl2::ref(comp), __index_projection<I, Proj>{first, proj});
+				return indices;
+			}
+
+			template<RandomAccessRange R, class Comp = less, class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<iterator_t<R>, Proj>>
+			std::vector<iter_difference_t<iterator_t<R>>>
+			operator()(R&& r, const iter_difference_t<iterator_t<R>> k,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(r), end(r), k, __stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __partial_sort_indices_fn partial_sort_indices {};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,50 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SORT_SMALL_HPP
+#define STL2_DETAIL_ALGORITHM_SORT_SMALL_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/sorting_network.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// sort_small [Extension]
+//
+// Sorts the n elements beginning at first with a sorting network when n
+// is at most 32, and with sort otherwise. Intended for the many tiny
+// sorts of a larger computation, where it avoids sort's loop overhead
+// and data-dependent branches.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __sort_small_fn : private __niebloid {
+			template<RandomAccessIterator I, class Comp = less, class Proj = identity>
+			requires Sortable<I, Comp, Proj>
+			constexpr I operator()(I first, const iter_difference_t<I> n,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				STL2_EXPECT(0 <= n);
+				if (n <= detail::max_network_sort_size) {
+					detail::network_sort(first, n, comp, proj);
+					return first + n;
+				}
+				return __stl2::sort(first, first + n,
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __sort_small_fn sort_small {};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,180 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SORTING_NETWORK_HPP
+#define STL2_DETAIL_ALGORITHM_SORTING_NETWORK_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/pdq_partition.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Sorting networks for small ranges [Implementation detail]
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Ranges no longer than this can be sorted by a network.
+		inline constexpr std::ptrdiff_t max_network_sort_size = 32;
+
+		// The sorting network for N elements given by Batcher's merge
+		// exchange (Knuth, TAOCP Vol. 3, 5.2.2 Algorithm M), generated at
+		// compile time. It is optimal for N <= 8, and within about 8% of the
+		// smallest known networks for N <= 32: 31 comparators against 29 for
+		// N = 10, 91 against 85 for N = 19 and 107 against 99 for N = 21.
+		template<std::size_t N>
+		requires N <= max_network_sort_size
+		struct sorting_network {
+			struct comparator {
+				unsigned char first, second;
+			};
+
+		private:
+			template<class F>
+			static constexpr void generate(F f) {
+				if (N < 2) {
+					return;
+				}
+				std::size_t t = 0;
+				while ((std::size_t{1} << t) < N) {
+					++t;
+				}
+				for (std::size_t p = std::size_t{1} << (t - 1); p > 0; p >>= 1) {
+					std::size_t q = std::size_t{1} << (t - 1);
+					std::size_t r = 0;
+					std::size_t d = p;
+					while (true) {
+						for (std::size_t i = 0; i + d < N; ++i) {
+							if ((i & p) == r) {
+								f(i, i + d);
+							}
+						}
+						if (q == p) {
+							break;
+						}
+						d = q - p;
+						q >>= 1;
+						r = p;
+					}
+				}
+			}
+
+			static constexpr std::size_t count() {
+				std::size_t n = 0;
+				generate([&n](std::size_t, std::size_t) { ++n; });
+				return n;
+			}
+
+		public:
+			static constexpr std::size_t size = count();
+
+			static constexpr std::array<comparator, size> comparators = [] {
+				std::array<comparator, size> result{};
+				std::size_t k = 0;
+				generate([&](std::size_t i, std::size_t j) {
+					result[k++] = {static_cast<unsigned char>(i), static_cast<unsigned char>(j)};
+				});
+				return result;
+			}();
+		};
+
+		// The elements are cheap enough to compare and copy that a
+		// compare-exchange is best done with conditional moves.
+		template<class I, class Comp, class Proj>
+		META_CONCEPT __branchless_exchangeable =
+			__branchless_sortable<I, Comp, Proj> &&
+			std::is_arithmetic_v<iter_value_t<I>> &&
+			Same<iter_reference_t<I>, iter_value_t<I>&>;
+
+		struct network_sort_fn {
+		private:
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			static constexpr void compare_exchange(I a, I b, Comp& comp, Proj& proj)
+			{
+				if constexpr (__branchless_exchangeable<I, Comp, Proj>) {
+					const iter_value_t<I> x = *a;
+					const iter_value_t<I> y = *b;
+					const bool swap = __stl2::invoke(comp,
+						__stl2::invoke(proj, y), __stl2::invoke(proj, x));
+					*a = swap ? y : x;
+					*b = swap ? x : y;
+				} else {
+					if (__stl2::invoke(comp, __stl2::invoke(proj, *b), __stl2::invoke(proj, *a))) {
+						iter_swap(a, b);
+					}
+				}
+			}
+
+			template<std::size_t N, class I, class Comp, class Proj, std::size_t... Ks>
+			static constexpr void apply(I first, Comp& comp, Proj& proj,
+				std::index_sequence<Ks...>)
+			{
+				using D = iter_difference_t<I>;
+				constexpr auto& net = sorting_network<N>::comparators;
+				(compare_exchange(first + D(net[Ks].first), first + D(net[Ks].second),
+					comp, proj), ...);
+			}
+
+			template<std::size_t N, class I, class Comp, class Proj>
+			static constexpr void sort_n(I first, Comp& comp, Proj& proj) {
+				if constexpr (sorting_network<N>::size != 0) {
+					apply<N>(first, comp, proj,
+						std::make_index_sequence<sorting_network<N>::size>{});
+				}
+			}
+
+			template<class I, class Comp, class Proj, std::size_t... Ns>
+			static constexpr void dispatch(I first, std::size_t n, Comp& comp, Proj& proj,
+				std::index_sequence<Ns...>)
+			{
+				constexpr void (*table[])(I, Comp&, Proj&) = {&sort_n<Ns, I, Comp, Proj>...};
+				table[n](first, comp, proj);
+			}
+
+		public:
+			// Sorts [first, first + N).
+			template<std::size_t N, RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj> && (N <= max_network_sort_size)
+			static constexpr void sort(I first, Comp& comp, Proj& proj) {
+				sort_n<N>(first, comp, proj);
+			}
+
+			// Sorts [first, first + n), for n <= Max. Only the networks for
+			// lengths up to Max are instantiated.
+			template<std::size_t Max, RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj> && (Max <= max_network_sort_size)
+			static constexpr void sort_up_to(I first, const iter_difference_t<I> n,
+				Comp& comp, Proj& proj)
+			{
+				STL2_EXPECT(0 <= n && n <= iter_difference_t<I>(Max));
+				dispatch(first, static_cast<std::size_t>(n), comp, proj,
+					std::make_index_sequence<Max + 1>{});
+			}
+
+			// Sorts [first, first + n), for n <= max_network_sort_size.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires Sortable<I, Comp, Proj>
+			constexpr void operator()(I first, const iter_difference_t<I> n,
+				Comp& comp, Proj& proj) const
+			{
+				sort_up_to<max_network_sort_size>(first, n, comp, proj);
+			}
+		};
+
+		inline constexpr network_sort_fn network_sort {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -43,7 +43,10 @@
 #include <stl2/detail/algorithm/merge.hpp>
 #include <stl2/detail/algorithm/min.hpp>
 #include <stl2/detail/algorithm/random_access_sort.hpp>
+#include <stl2/detail/algorithm/reverse.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/concepts.hpp>
+#include <limits>
 
 ///////////////////////////////////////////////////////////////////////////
 // stable_sort [stable.sort]
@@ -53,8 +56,6 @@ STL2_OPEN_NAMESPACE {
 		template<class I>
 		using buf_t = detail::temporary_buffer<iter_value_t<I>>;
 
-		static constexpr int merge_sort_chunk_size = 7;
-
 		template<RandomAccessIterator I, class C, class P>
 		requires Sortable<I, C, P>
 		static void inplace_stable_sort(I first, I last, C &pred, P &proj) {
@@ -70,95 +71,185 @@ STL2_OPEN_NAMESPACE {
 			}
 		}
 
-		template<RandomAccessIterator I, WeaklyIncrementable O, class C, class P>
+		// Powersort, after Munro and Wild, "Nearly-Optimal Mergesorts: Fast,
+		// Practical Sorting Methods That Optimally Adapt to Existing Runs"
+		// (2018): merges natural runs in an order chosen so that the total
+		// merge cost is near the entropy of the run lengths.
+
+		// Runs shorter than this are extended by insertion sort.
+		static constexpr std::ptrdiff_t min_run_length = 16;
+
+		// Returns the end of the run beginning at first: the longest
+		// non-descending or strictly descending prefix of [first, last),
+		// which is reversed in the latter case.
+		template<RandomAccessIterator I, class C, class P>
 		requires Sortable<I, C, P>
-		static void merge_sort_loop(I first, I last, O result,
-			iter_difference_t<I> step_size, C &pred, P &proj) {
-			auto two_step = iter_difference_t<I>(2 * step_size);
-			while (last - first >= two_step) {
-				result = merge(
-					__stl2::make_move_iterator(first),
-					__stl2::make_move_iterator(first + step_size),
-					__stl2::make_move_iterator(first + step_size),
-					__stl2::make_move_iterator(first + two_step),
-					result, __stl2::ref(pred),
-					__stl2::ref(proj), __stl2::ref(proj)).out;
-				first += two_step;
+		static I count_run(I first, I last, C &comp, P &proj) {
+			I i = next(first);
+			if (i == last) {
+				return i;
+			}
+			if (__stl2::invoke(comp, __stl2::invoke(proj, *i), __stl2::invoke(proj, *first))) {
+				while (++i != last &&
+					__stl2::invoke(comp, __stl2::invoke(proj, *i), __stl2::invoke(proj, *prev(i))))
+				{
+					; // do nothing
+				}
+				reverse(first, i);
+			} else {
+				while (++i != last &&
+					!__stl2::invoke(comp, __stl2::invoke(proj, *i), __stl2::invoke(proj, *prev(i))))
+				{
+					; // do nothing
+				}
+			}
+			return i;
+		}
+
+		// The depth in the merge tree of the boundary between adjacent runs
+		// of lengths n1 and n2 beginning at s1 in a range of length n: the
+		// number of leading bits that the binary expansions of the runs'
+		// midpoints relative to n share, plus one.
+		template<class D>
+		static constexpr int node_power(D s1, D n1, D n2, D n) {
+			auto a = D(2 * s1 + n1);
+			auto b = D(a + n1 + n2);
+			int result = 0;
+			while (true) {
+				++result;
+				if (a >= n) {
+					a -= n;
+					b -= n;
+				} else if (b >= n) {
+					return result;
+				}
+				a *= 2;
+				b *= 2;
 			}
-			step_size = __stl2::min(iter_difference_t<I>(last - first), step_size);
-			merge(
-				__stl2::make_move_iterator(first),
-				__stl2::make_move_iterator(first + step_size),
-				__stl2::make_move_iterator(first + step_size),
-				__stl2::make_move_iterator(last),
-				result, __stl2::ref(pred),
-				__stl2::ref(proj), __stl2::ref(proj));
 		}
 
+		// Merges the adjacent sorted runs [first, middle) and [middle, last).
+		// Leading elements of the first run and trailing elements of the
+		// second that are already in place are found by galloping, so
+		// merging a short run into a long one costs little more than the
+		// length of the short run.
 		template<RandomAccessIterator I, class C, class P>
 		requires Sortable<I, C, P>
-		static void chunk_insertion_sort(I first, I last,
-			iter_difference_t<I> chunk_size, C &comp, P &proj) {
-			while (last - first >= chunk_size) {
-				detail::rsort::insertion_sort(first, first + chunk_size, comp, proj);
-				first += chunk_size;
+		static void merge_runs(I first, I middle, I last, buf_t<I>& buf, C &comp, P &proj) {
+			auto&& head = __stl2::invoke(proj, *middle);
+			auto not_after_head = [&](auto&& x) -> bool {
+				return !__stl2::invoke(comp, head, x);
+			};
+			first += detail::gallop(first, middle - first, not_after_head, proj);
+			if (first == middle) {
+				return;
 			}
-			detail::rsort::insertion_sort(first, last, comp, proj);
+
+			using RI = reverse_iterator<I>;
+			auto&& tail = __stl2::invoke(proj, *prev(middle));
+			auto not_before_tail = [&](auto&& x) -> bool {
+				return !__stl2::invoke(comp, x, tail);
+			};
+			last -= detail::gallop(RI{last}, last - middle, not_before_tail, proj);
+
+			detail::merge_adaptive(first, middle, last,
+				middle - first, last - middle, buf,
+				__stl2::ref(comp), __stl2::ref(proj));
 		}
 
 		template<RandomAccessIterator I, class C, class P>
 		requires Sortable<I, C, P>
-		static void merge_sort_with_buffer(I first, I last, buf_t<I>& buf, C &comp, P &proj) {
-			auto len = iter_difference_t<I>(last - first);
-			auto step_size = iter_difference_t<I>(merge_sort_chunk_size);
-			chunk_insertion_sort(first, last, step_size, comp, proj);
-			if (step_size >= len) {
-				return;
+		static void powersort(I first, I last, buf_t<I>& buf, C &comp, P &proj) {
+			using D = iter_difference_t<I>;
+			const auto n = D(last - first);
+			// Powers strictly increase up the stack, and are bounded by the
+			// number of bits in n.
+			constexpr int max_runs = std::numeric_limits<D>::digits + 2;
+			D starts[max_runs];
+			int powers[max_runs];
+			int top = 0;
+
+			// [run_start, run_end) is the newest run; the stack holds the
+			// starts of the runs before it, each with the power of its
+			// boundary with the following run.
+			D run_start = 0;
+			D run_end = D(count_run(first, last, comp, proj) - first);
+			if (run_end < min_run_length && run_end < n) {
+				run_end = __stl2::min(n, D(min_run_length));
+				detail::rsort::insertion_sort(first, first + run_end, comp, proj);
 			}
-			detail::temporary_vector<iter_value_t<I>> vec{buf};
-			merge_sort_loop(first, last, __stl2::back_inserter(vec), step_size, comp, proj);
-			step_size *= 2;
-			while (true) {
-				merge_sort_loop(vec.begin(), vec.end(), first, step_size, comp, proj);
-				step_size *= 2;
-				if (step_size >= len) {
-					return;
+			while (run_end < n) {
+				D next_end = D(count_run(first + run_end, last, comp, proj) - first);
+				if (next_end - run_end < min_run_length && next_end < n) {
+					next_end = __stl2::min(n, D(run_end + min_run_length));
+					detail::rsort::insertion_sort(first + run_end, first + next_end, comp, proj);
+				}
+				const int p = node_power(run_start, D(run_end - run_start),
+					D(next_end - run_end), n);
+				// Merge the runs below boundaries deeper than this one.
+				while (top > 0 && powers[top - 1] > p) {
+					--top;
+					merge_runs(first + starts[top], first + run_start, first + run_end,
+						buf, comp, proj);
+					run_start = starts[top];
 				}
-				merge_sort_loop(first, last, vec.begin(), step_size, comp, proj);
-				step_size *= 2;
+				starts[top] = run_start;
+				powers[top] = p;
+				++top;
+				run_start = run_end;
+				run_end = next_end;
+			}
+			while (top > 0) {
+				--top;
+				merge_runs(first + starts[top], first + run_start, last, buf, comp, proj);
+				run_start = starts[top];
 			}
 		}
 
 		template<RandomAccessIterator I, class C, class P>
 		requires Sortable<I, C, P>
-		static void stable_sort_adaptive(I first, I last, buf_t<I>& buf, C &comp, P &proj) {
-			auto len = iter_difference_t<I>((last - first + 1) / 2);
-			auto middle = first + len;
-			if (len > buf.size()) {
-				stable_sort_adaptive(first, middle, buf, comp, proj);
-				stable_sort_adaptive(middle, last, buf, comp, proj);
+		static void stable_sort_random_access(I first, I last, C &comp, P &proj) {
+			auto len = iter_difference_t<I>(last - first);
+			auto buf = len > 256 ? buf_t<I>{len} : buf_t<I>{};
+			if (!buf.size()) {
+				inplace_stable_sort(first, last, comp, proj);
 			} else {
-				merge_sort_with_buffer(first, middle, buf, comp, proj);
-				merge_sort_with_buffer(middle, last, buf, comp, proj);
+				powersort(first, last, buf, comp, proj);
 			}
-			detail::merge_adaptive(first, middle, last,
-				middle - first, last - middle, buf,
-				__stl2::ref(comp), __stl2::ref(proj));
 		}
 
+		// Parallel stable sort: merge sort whose merges are split across
+		// tasks along merge paths. Ranges no longer than this are sorted
+		// by a single task. <stl2/execution.hpp> defines the functions
+		// below.
+		static constexpr std::ptrdiff_t parallel_sort_grain = std::ptrdiff_t{1} << 15;
+
+		// Merges the sorted ranges [first, middle) and [middle, last) into
+		// [out, out + (last - first)), with up to chunks tasks.
+		template<RandomAccessIterator I, RandomAccessIterator O, class C, class P>
+		requires Sortable<I, C, P> && IndirectlyMovable<I, O>
+		static void parallel_merge(I first, I middle, I last, O out,
+			std::ptrdiff_t chunks, C &comp, P &proj);
+
+		// Sorts the n elements at src, leaving the result at dst if to_dst
+		// and at src otherwise. dst points to n initialized elements.
+		template<RandomAccessIterator I, RandomAccessIterator O, class C, class P>
+		requires Sortable<I, C, P> && Sortable<O, C, P> &&
+			IndirectlyMovable<I, O> && IndirectlyMovable<O, I>
+		static void parallel_merge_sort(I src, O dst, iter_difference_t<I> n,
+			bool to_dst, std::ptrdiff_t chunks, C &comp, P &proj);
+
+		template<RandomAccessIterator I, class C, class P>
+		requires Sortable<I, C, P>
+		static void parallel_stable_sort(I first, I last, C &comp, P &proj);
+
 		// Extension: Supports forward iterators.
 		template<class I, class S, class Comp = less, class Proj = identity>
 		requires Sentinel<__f<S>, I> && Sortable<I, Comp, Proj>
 		I operator()(I first, S&& last_, Comp comp = {}, Proj proj = {}) const {
 			if constexpr (RandomAccessIterator<I>) {
 				auto last = next(first, std::forward<S>(last_));
-				auto len = iter_difference_t<I>(last - first);
-				auto buf = len > 256 ? buf_t<I>{len} : buf_t<I>{};
-				if (!buf.size_) {
-					inplace_stable_sort(first, last, comp, proj);
-				} else {
-					stable_sort_adaptive(first, last, buf, comp, proj);
-				}
+				stable_sort_random_access(first, last, comp, proj);
 				return last;
 			} else {
 				auto n = distance(first, std::forward<S>(last_));
@@ -179,6 +270,34 @@ STL2_OPEN_NAMESPACE {
 					__stl2::ref(comp), __stl2::ref(proj));
 			}
 		}
+
+		// Extension: stable_sort with an execution policy. The result does
+		// not depend on the number of threads.
+		template<ext::ExecutionPolicy EP, RandomAccessIterator I, Sentinel<I> S,
+			class Comp = less, class Proj = identity>
+		requires Sortable<I, Comp, Proj>
+		I operator()(EP&&, I first, S sent, Comp comp = {}, Proj proj = {}) const {
+			auto last = next(first, std::move(sent));
+			if constexpr (ext::__parallel_policy<EP>) {
+				if (last - first > parallel_sort_grain) {
+					parallel_stable_sort(first, last, comp, proj);
+					return last;
+				}
+			}
+			stable_sort_random_access(first, last, comp, proj);
+			return last;
+		}
+
+		// Extension: stable_sort with an execution policy.
+		template<ext::ExecutionPolicy EP, RandomAccessRange Rng, class Comp = less,
+			class Proj = identity>
+		requires Sortable<iterator_t<Rng>, Comp, Proj>
+		safe_iterator_t<Rng> operator()(EP&& ep, Rng&& rng, Comp comp = {},
+			Proj proj = {}) const
+		{
+			return (*this)(std::forward<EP>(ep), begin(rng), end(rng),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
 	};
 
 	inline constexpr __stable_sort_fn stable_sort {};
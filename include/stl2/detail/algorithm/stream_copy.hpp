@@ -0,0 +1,51 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_STREAM_COPY_HPP
+#define STL2_DETAIL_ALGORITHM_STREAM_COPY_HPP
+
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// stream_copy [Extension]
+//
+// copy, with non-temporal stores when it copies contiguous trivially
+// copyable objects between ranges that don't overlap: for destinations
+// larger than the last-level cache, which aren't read again soon, so
+// that they don't evict the rest of the working set. Other ranges are
+// copied as by copy.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __stream_copy_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, WeaklyIncrementable O>
+			requires IndirectlyCopyable<I, O>
+			copy_result<I, O> operator()(I first, S last, O result) const {
+				if constexpr (SizedSentinel<S, I> && detail::__memcopyable<I, O>) {
+					return detail::bulk_copy(first, last - first, result, true);
+				} else {
+					return __stl2::copy(std::move(first), std::move(last), std::move(result));
+				}
+			}
+
+			template<InputRange R, WeaklyIncrementable O>
+			requires IndirectlyCopyable<iterator_t<R>, O>
+			copy_result<safe_iterator_t<R>, O> operator()(R&& r, O result) const {
+				return (*this)(begin(r), end(r), std::move(result));
+			}
+		};
+
+		inline constexpr __stream_copy_fn stream_copy {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,47 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_STREAM_FILL_HPP
+#define STL2_DETAIL_ALGORITHM_STREAM_FILL_HPP
+
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_fill.hpp>
+#include <stl2/detail/algorithm/fill.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// stream_fill [Extension]
+//
+// fill, with non-temporal stores when it fills contiguous trivially
+// copyable objects, as stream_copy copies them. Other ranges are filled
+// as by fill.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __stream_fill_fn : private __niebloid {
+			template<class T, OutputIterator<const T&> O, Sentinel<O> S>
+			O operator()(O first, S last, const T& value) const {
+				if constexpr (SizedSentinel<S, O> && detail::__memfillable<O, T>) {
+					return detail::bulk_fill(first, last - first, value, true);
+				} else {
+					return __stl2::fill(std::move(first), std::move(last), value);
+				}
+			}
+
+			template<class T, OutputRange<const T&> R>
+			safe_iterator_t<R> operator()(R&& r, const T& value) const {
+				return (*this)(begin(r), end(r), value);
+			}
+		};
+
+		inline constexpr __stream_fill_fn stream_fill {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
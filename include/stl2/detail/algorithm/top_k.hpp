@@ -0,0 +1,124 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_TOP_K_HPP
+#define STL2_DETAIL_ALGORITHM_TOP_K_HPP
+
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/nth_element.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// top_k [Extension]
+//
+// Returns the k least elements of an input range, in order, in a vector.
+// The elements are streamed through a buffer of 2k or more: once it fills,
+// nth_element prunes it back to the k least, and thereafter an element
+// that doesn't beat the k-th least so far costs a single comparison. This
+// is O(n + k log k) regardless of the order of the input, where a heap of
+// k elements is O(n log k) when each element displaces the top.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// The capacity of the buffer used to find the k least elements:
+		// room for at least as many again, so that pruning - linear in
+		// the capacity - is amortized over as many elements.
+		constexpr std::ptrdiff_t top_k_buffer_size(const std::ptrdiff_t k) noexcept {
+			constexpr std::ptrdiff_t min_slack = 1024;
+			return k + (k < min_slack ? min_slack : k);
+		}
+
+		// Appends the elements of [first, last) to buf, whose size must be
+		// able to reach top_k_buffer_size(k), pruning it to the k least
+		// elements when full. Afterwards buf holds the min(k, n) least
+		// elements, in order.
+		template<InputIterator I, Sentinel<I> S, class Buf, class Comp,
+			class Proj1, class Proj2>
+		I stream_top_k(I first, S last, Buf& buf, const std::ptrdiff_t k,
+			Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			STL2_EXPECT(k > 0);
+			const auto capacity = top_k_buffer_size(k);
+			const auto prune = [&] {
+				__stl2::nth_element(buf.begin(), buf.begin() + (k - 1), buf.end(),
+					__stl2::ref(comp), __stl2::ref(proj2));
+				while (std::ptrdiff_t(buf.size()) > k) {
+					buf.pop_back();
+				}
+			};
+			bool pruned = false;
+			for (; first != last; ++first) {
+				iter_reference_t<I>&& x = *first;
+				if (pruned && !__stl2::invoke(comp,
+					__stl2::invoke(proj1, x), __stl2::invoke(proj2, buf[k - 1])))
+				{
+					continue;
+				}
+				if (std::ptrdiff_t(buf.size()) == capacity) {
+					prune();
+					pruned = true;
+					if (!__stl2::invoke(comp,
+						__stl2::invoke(proj1, x), __stl2::invoke(proj2, buf[k - 1])))
+					{
+						continue;
+					}
+				}
+				buf.emplace_back(std::forward<iter_reference_t<I>>(x));
+			}
+			if (std::ptrdiff_t(buf.size()) > k) {
+				prune();
+			}
+			__stl2::sort(buf.begin(), buf.end(), __stl2::ref(comp), __stl2::ref(proj2));
+			return first;
+		}
+	}
+
+	namespace ext {
+		struct __top_k_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, class Comp = less, class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<I, Proj>> &&
+				Constructible<iter_value_t<I>, iter_reference_t<I>> &&
+				Sortable<iter_value_t<I>*, Comp, Proj>
+			std::vector<iter_value_t<I>>
+			operator()(I first, S last, const iter_difference_t<I> k,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				STL2_EXPECT(k >= 0);
+				std::vector<iter_value_t<I>> buf;
+				if (k > 0) {
+					buf.reserve(static_cast<std::size_t>(
+						detail::top_k_buffer_size(std::ptrdiff_t(k))));
+					detail::stream_top_k(std::move(first), std::move(last), buf,
+						std::ptrdiff_t(k), comp, proj, proj);
+				}
+				return buf;
+			}
+
+			template<InputRange R, class Comp = less, class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<iterator_t<R>, Proj>> &&
+				Constructible<iter_value_t<iterator_t<R>>, iter_reference_t<iterator_t<R>>> &&
+				Sortable<iter_value_t<iterator_t<R>>*, Comp, Proj>
+			std::vector<iter_value_t<iterator_t<R>>>
+			operator()(R&& r, const iter_difference_t<iterator_t<R>> k,
+				Comp comp = {}, Proj proj = {}) const
+			{
+				return (*this)(begin(r), end(r), k, __stl2::ref(comp), __stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __top_k_fn top_k {};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
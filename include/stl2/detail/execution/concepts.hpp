@@ -0,0 +1,43 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_CONCEPTS_HPP
+#define STL2_DETAIL_EXECUTION_CONCEPTS_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// ExecutionPolicy [Extension]
+//
+// The algorithms declare their overloads for execution policies against
+// these alone. Only <stl2/execution.hpp> defines the policies, together
+// with the parallel code and its thread pool, so that a program that
+// never passes a policy never includes - or links - the threads.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct sequenced_policy;
+		struct parallel_policy;
+		struct parallel_unsequenced_policy;
+
+		template<class T>
+		META_CONCEPT ExecutionPolicy =
+			Same<__uncvref<T>, sequenced_policy> ||
+			Same<__uncvref<T>, parallel_policy> ||
+			Same<__uncvref<T>, parallel_unsequenced_policy>;
+
+		// Policies that permit an algorithm to run on more than one thread.
+		template<class T>
+		META_CONCEPT __parallel_policy =
+			ExecutionPolicy<T> && !Same<__uncvref<T>, sequenced_policy>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,91 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_INPLACE_MERGE_HPP
+#define STL2_DETAIL_EXECUTION_INPLACE_MERGE_HPP
+
+#include <cstddef>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/inplace_merge.hpp>
+#include <stl2/detail/algorithm/merge.hpp>
+#include <stl2/detail/execution/merge_path.hpp>
+#include <stl2/detail/execution/thread_pool.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// inplace_merge with an execution policy [Extension]
+//
+// The parallel merge that <stl2/detail/algorithm/inplace_merge.hpp>
+// declares.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<RandomAccessIterator I, class C, class P>
+		requires Sortable<I, C, P>
+		bool parallel_inplace_merge(I first, I middle, I last, C& comp, P& proj)
+		{
+			using T = iter_value_t<I>;
+			using D = iter_difference_t<I>;
+			const auto n = D(last - first);
+			const auto chunks = parallel_merge_chunks(std::ptrdiff_t(n));
+			if (chunks < 2) {
+				return false;
+			}
+			temporary_buffer<T> buf{n};
+			if (buf.size() < n) {
+				return false;
+			}
+			T* const tmp = buf.data();
+			// The number of elements each task has constructed in the buffer.
+			std::vector<std::ptrdiff_t> constructed(chunks);
+			struct guard {
+				T* tmp;
+				std::ptrdiff_t n;
+				std::vector<std::ptrdiff_t>& constructed;
+				~guard() {
+					const auto chunks = std::ptrdiff_t(constructed.size());
+					for (std::ptrdiff_t k = 0; k < chunks; ++k) {
+						T* const p = tmp + n * k / chunks;
+						for (std::ptrdiff_t i = 0; i < constructed[k]; ++i) {
+							detail::destruct(p[i]);
+						}
+					}
+				}
+			} g{tmp, n, constructed};
+			parallel_for(chunks, [&](const std::ptrdiff_t k) {
+				const auto lo = n * k / chunks;
+				const auto hi = n * (k + 1) / chunks;
+				auto& count = constructed[k];
+				for (; lo + count < hi; ++count) {
+					detail::construct(tmp[lo + count], iter_move(first + D(lo + count)));
+				}
+			});
+			const auto n1 = std::ptrdiff_t(middle - first);
+			const auto splits = merge_splits(tmp, n1, tmp + n1, n - n1, chunks, false,
+				comp, proj, proj);
+			parallel_for(chunks, [&](const std::ptrdiff_t k) {
+				const auto [i, j] = splits[k];
+				const auto [i_end, j_end] = splits[k + 1];
+				__stl2::merge(
+					__stl2::make_move_iterator(tmp + i),
+					__stl2::make_move_iterator(tmp + i_end),
+					__stl2::make_move_iterator(tmp + (n1 + j)),
+					__stl2::make_move_iterator(tmp + (n1 + j_end)),
+					first + D(i + j), __stl2::ref(comp), __stl2::ref(proj),
+					__stl2::ref(proj));
+			});
+			return true;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,53 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_MERGE_HPP
+#define STL2_DETAIL_EXECUTION_MERGE_HPP
+
+#include <cstddef>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/merge.hpp>
+#include <stl2/detail/execution/merge_path.hpp>
+#include <stl2/detail/execution/thread_pool.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// merge with an execution policy [Extension]
+//
+// Each task merges the pieces of the inputs that make an equal slice of
+// the output, split along the merge path.
+//
+STL2_OPEN_NAMESPACE {
+	template<RandomAccessIterator I1, RandomAccessIterator I2,
+		RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+	requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+	O __merge_fn::parallel_merge(I1 first1, iter_difference_t<I1> n1,
+		I2 first2, iter_difference_t<I2> n2, O result,
+		Comp& comp, Proj1& proj1, Proj2& proj2)
+	{
+		const auto chunks = detail::parallel_merge_chunks(std::ptrdiff_t(n1 + n2));
+		if (chunks < 2) {
+			return merge(first1, first1 + n1, first2, first2 + n2, std::move(result),
+				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2)).out;
+		}
+		const auto splits = detail::merge_splits(first1, n1, first2, n2,
+			chunks, false, comp, proj1, proj2);
+		detail::parallel_for(chunks, [&](const std::ptrdiff_t k) {
+			const auto [i, j] = splits[k];
+			const auto [i_end, j_end] = splits[k + 1];
+			merge(first1 + i, first1 + i_end, first2 + j, first2 + j_end,
+				result + iter_difference_t<O>(i + j), __stl2::ref(comp),
+				__stl2::ref(proj1), __stl2::ref(proj2));
+		});
+		return result + iter_difference_t<O>(n1 + n2);
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
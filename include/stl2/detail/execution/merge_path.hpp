@@ -0,0 +1,129 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_MERGE_PATH_HPP
+#define STL2_DETAIL_EXECUTION_MERGE_PATH_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/partition_point.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/thread_pool.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// merge_path [Implementation detail]
+//
+// Splits a merge into independent pieces: the first d elements of the
+// merge of two sorted ranges are the first i elements of the first range
+// and the first d - i of the second, for the i found by binary search along
+// the d-th cross diagonal of the "merge matrix." See Odeh, Green, Mwassi,
+// Shmueli and Birk, "Merge Path - Parallel Merging Made Simple" (2012).
+// The parallel merge, inplace_merge and set operations give each task an
+// equal slice of the output this way.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Returns the number of elements of [first1, first1 + n1) among the
+		// first d elements of its stable merge - equivalent elements of the
+		// first range precede those of the second - with
+		// [first2, first2 + n2).
+		template<RandomAccessIterator I1, RandomAccessIterator I2,
+			class Comp, class Proj1, class Proj2>
+		requires IndirectStrictWeakOrder<Comp, projected<I1, Proj1>, projected<I2, Proj2>>
+		constexpr iter_difference_t<I1>
+		merge_path(I1 first1, const iter_difference_t<I1> n1,
+			I2 first2, const iter_difference_t<I2> n2, const iter_difference_t<I1> d,
+			Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			STL2_EXPECT(0 <= d && d <= n1 + n2);
+			auto lo = d > n2 ? iter_difference_t<I1>(d - n2) : iter_difference_t<I1>(0);
+			auto hi = d < n1 ? d : n1;
+			while (lo < hi) {
+				// Is first1[mid] among the first d elements?
+				const auto mid = lo + (hi - lo) / 2;
+				if (__stl2::invoke(comp,
+					__stl2::invoke(proj2, first2[iter_difference_t<I2>(d - mid - 1)]),
+					__stl2::invoke(proj1, first1[mid])))
+				{
+					hi = mid;
+				} else {
+					lo = mid + 1;
+				}
+			}
+			return lo;
+		}
+
+		// Merges of fewer elements than this run as a single task.
+		inline constexpr std::ptrdiff_t parallel_merge_grain = std::ptrdiff_t{1} << 15;
+
+		// The number of tasks to share a merge of n elements: a few per
+		// thread, so that they balance, but none shorter than the grain.
+		inline std::ptrdiff_t parallel_merge_chunks(const std::ptrdiff_t n) {
+			const auto per_threads = std::ptrdiff_t(
+				4 * thread_pool::instance().concurrency());
+			const auto per_grain = (n + parallel_merge_grain - 1) / parallel_merge_grain;
+			return per_threads < per_grain ? per_threads : per_grain;
+		}
+
+		// Splits the merge of [first1, first1 + n1) and [first2, first2 + n2)
+		// into chunks pieces, of equal length, which can be merged
+		// independently: returns {i, j} for each piece, such that it merges
+		// first1[i, i') with first2[j, j') where {i', j'} is that of the next,
+		// and last {n1, n2}. If whole_runs, a piece begins instead at the
+		// start of the run of elements equivalent to its first, so that no
+		// two pieces hold equivalent elements, as the set operations need.
+		template<RandomAccessIterator I1, RandomAccessIterator I2,
+			class Comp, class Proj1, class Proj2>
+		requires IndirectStrictWeakOrder<Comp, projected<I1, Proj1>, projected<I2, Proj2>>
+		std::vector<std::pair<iter_difference_t<I1>, iter_difference_t<I2>>>
+		merge_splits(I1 first1, const iter_difference_t<I1> n1,
+			I2 first2, const iter_difference_t<I2> n2, const std::ptrdiff_t chunks,
+			const bool whole_runs, Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			using D1 = iter_difference_t<I1>;
+			using D2 = iter_difference_t<I2>;
+			STL2_EXPECT(chunks > 0);
+			const auto n = D1(n1 + n2);
+			std::vector<std::pair<D1, D2>> splits(chunks + 1);
+			for (std::ptrdiff_t k = 0; k < chunks; ++k) {
+				const auto d = D1(n * k / chunks);
+				auto i = detail::merge_path(first1, n1, first2, n2, d, comp, proj1, proj2);
+				auto j = D2(d - i);
+				if (whole_runs) {
+					// Count the elements of each range less than key.
+					auto to_run = [&](auto&& key) {
+						i = D1(__stl2::ext::partition_point_n(first1, i, [&](auto&& x) {
+							return __stl2::invoke(comp, x, key);
+						}, __stl2::ref(proj1)) - first1);
+						j = D2(__stl2::ext::partition_point_n(first2, j, [&](auto&& y) {
+							return __stl2::invoke(comp, y, key);
+						}, __stl2::ref(proj2)) - first2);
+					};
+					// The first element of the piece in merge order.
+					if (i < n1 && (j == n2 || !__stl2::invoke(comp,
+						__stl2::invoke(proj2, first2[j]), __stl2::invoke(proj1, first1[i]))))
+					{
+						to_run(__stl2::invoke(proj1, first1[i]));
+					} else if (j < n2) {
+						to_run(__stl2::invoke(proj2, first2[j]));
+					}
+				}
+				splits[k] = {i, j};
+			}
+			splits[chunks] = {n1, n2};
+			return splits;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,43 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_POLICY_HPP
+#define STL2_DETAIL_EXECUTION_POLICY_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/execution/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Execution policies [Extension]
+//
+// Algorithm overloads that accept one of these as their first argument may
+// use multiple threads of execution. Unlike the policies of the
+// standard library, an exception thrown by an element access function
+// propagates to the caller, leaving the range in a valid but unspecified
+// state.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct sequenced_policy {
+			explicit sequenced_policy() = default;
+		};
+		struct parallel_policy {
+			explicit parallel_policy() = default;
+		};
+		struct parallel_unsequenced_policy {
+			explicit parallel_unsequenced_policy() = default;
+		};
+
+		inline constexpr sequenced_policy seq {};
+		inline constexpr parallel_policy par {};
+		inline constexpr parallel_unsequenced_policy par_unseq {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
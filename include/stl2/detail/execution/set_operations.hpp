@@ -0,0 +1,161 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_SET_OPERATIONS_HPP
+#define STL2_DETAIL_EXECUTION_SET_OPERATIONS_HPP
+
+#include <cstddef>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/set_difference.hpp>
+#include <stl2/detail/algorithm/set_intersection.hpp>
+#include <stl2/detail/algorithm/set_symmetric_difference.hpp>
+#include <stl2/detail/algorithm/set_union.hpp>
+#include <stl2/detail/execution/merge_path.hpp>
+#include <stl2/detail/execution/thread_pool.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Set operations with an execution policy [Extension]
+//
+// Unlike merge, a set operation can't know where each task's output
+// begins until the tasks before it have run, so the inputs split between
+// runs of equivalent elements and each piece runs twice.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// An output iterator that only counts the elements written to it.
+		struct counting_output {
+			using difference_type = std::ptrdiff_t;
+
+			struct proxy {
+				template<class T>
+				const proxy& operator=(T&&) const noexcept {
+					return *this;
+				}
+			};
+
+			std::ptrdiff_t count = 0;
+
+			proxy operator*() const noexcept {
+				return {};
+			}
+			counting_output& operator++() noexcept {
+				++count;
+				return *this;
+			}
+			counting_output operator++(int) noexcept {
+				auto tmp = *this;
+				++count;
+				return tmp;
+			}
+		};
+
+		// Applies the set operation op - set_union, set_intersection, etc. -
+		// to [first1, first1 + n1) and [first2, first2 + n2) on up to chunks
+		// tasks, each taking a piece of the inputs between runs of equivalent
+		// elements. A first pass counts the output of each piece, and a second
+		// writes each at its offset. Returns the end of the output.
+		template<class Op, RandomAccessIterator I1, RandomAccessIterator I2,
+			RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+		requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+		O parallel_set_operation(const Op& op, I1 first1, const iter_difference_t<I1> n1,
+			I2 first2, const iter_difference_t<I2> n2, O result,
+			const std::ptrdiff_t chunks, Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			const auto splits = merge_splits(first1, n1, first2, n2, chunks, true,
+				comp, proj1, proj2);
+			auto piece = [&](const std::ptrdiff_t k, auto out) {
+				const auto [i, j] = splits[k];
+				const auto [i_end, j_end] = splits[k + 1];
+				return op(first1 + i, first1 + i_end, first2 + j, first2 + j_end,
+					std::move(out), __stl2::ref(comp), __stl2::ref(proj1),
+					__stl2::ref(proj2)).out;
+			};
+			std::vector<iter_difference_t<O>> offsets(chunks + 1);
+			parallel_for(chunks, [&](const std::ptrdiff_t k) {
+				offsets[k + 1] = iter_difference_t<O>(piece(k, counting_output{}).count);
+			});
+			for (std::ptrdiff_t k = 0; k < chunks; ++k) {
+				offsets[k + 1] += offsets[k];
+			}
+			parallel_for(chunks, [&](const std::ptrdiff_t k) {
+				piece(k, result + offsets[k]);
+			});
+			return result + offsets[chunks];
+		}
+	}
+
+	template<RandomAccessIterator I1, RandomAccessIterator I2,
+		RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+	requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+	O __set_union::parallel_set_union(I1 first1, iter_difference_t<I1> n1,
+		I2 first2, iter_difference_t<I2> n2, O result,
+		Comp& comp, Proj1& proj1, Proj2& proj2)
+	{
+		const auto chunks = detail::parallel_merge_chunks(std::ptrdiff_t(n1 + n2));
+		if (chunks < 2) {
+			return set_union(first1, first1 + n1, first2, first2 + n2, std::move(result),
+				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2)).out;
+		}
+		return detail::parallel_set_operation(set_union, first1, n1, first2, n2,
+			std::move(result), chunks, comp, proj1, proj2);
+	}
+
+	template<RandomAccessIterator I1, RandomAccessIterator I2,
+		RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+	requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+	O __set_intersection_fn::parallel_set_intersection(I1 first1, iter_difference_t<I1> n1,
+		I2 first2, iter_difference_t<I2> n2, O result,
+		Comp& comp, Proj1& proj1, Proj2& proj2)
+	{
+		const auto chunks = detail::parallel_merge_chunks(std::ptrdiff_t(n1 + n2));
+		if (chunks < 2) {
+			return set_intersection(first1, first1 + n1, first2, first2 + n2, std::move(result),
+				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2)).out;
+		}
+		return detail::parallel_set_operation(set_intersection, first1, n1, first2, n2,
+			std::move(result), chunks, comp, proj1, proj2);
+	}
+
+	template<RandomAccessIterator I1, RandomAccessIterator I2,
+		RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+	requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+	O __set_difference_fn::parallel_set_difference(I1 first1, iter_difference_t<I1> n1,
+		I2 first2, iter_difference_t<I2> n2, O result,
+		Comp& comp, Proj1& proj1, Proj2& proj2)
+	{
+		const auto chunks = detail::parallel_merge_chunks(std::ptrdiff_t(n1 + n2));
+		if (chunks < 2) {
+			return set_difference(first1, first1 + n1, first2, first2 + n2, std::move(result),
+				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2)).out;
+		}
+		return detail::parallel_set_operation(set_difference, first1, n1, first2, n2,
+			std::move(result), chunks, comp, proj1, proj2);
+	}
+
+	template<RandomAccessIterator I1, RandomAccessIterator I2,
+		RandomAccessIterator O, class Comp, class Proj1, class Proj2>
+	requires Mergeable<I1, I2, O, Comp, Proj1, Proj2>
+	O __set_symmetric_difference_fn::parallel_set_symmetric_difference(I1 first1, iter_difference_t<I1> n1,
+		I2 first2, iter_difference_t<I2> n2, O result,
+		Comp& comp, Proj1& proj1, Proj2& proj2)
+	{
+		const auto chunks = detail::parallel_merge_chunks(std::ptrdiff_t(n1 + n2));
+		if (chunks < 2) {
+			return set_symmetric_difference(first1, first1 + n1, first2, first2 + n2, std::move(result),
+				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2)).out;
+		}
+		return detail::parallel_set_operation(set_symmetric_difference, first1, n1, first2, n2,
+			std::move(result), chunks, comp, proj1, proj2);
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,186 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_SORT_HPP
+#define STL2_DETAIL_EXECUTION_SORT_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/max.hpp>
+#include <stl2/detail/algorithm/min.hpp>
+#include <stl2/detail/algorithm/partition.hpp>
+#include <stl2/detail/algorithm/pdq_partition.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/execution/thread_pool.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// sort with an execution policy [Extension]
+//
+// The parallel quicksort that <stl2/detail/algorithm/sort.hpp> declares.
+//
+STL2_OPEN_NAMESPACE {
+	template<RandomAccessIterator I, class Pred, class Proj>
+	requires Permutable<I>
+	I __sort_fn::parallel_partition(I first, I last, Pred& pred, Proj& proj,
+		std::ptrdiff_t chunks)
+	{
+		using D = iter_difference_t<I>;
+		const auto n = D(last - first);
+		const auto size = D((n + chunks - 1) / chunks);
+		chunks = (n + size - 1) / size;
+		auto block_end = [&](std::ptrdiff_t k) {
+			return k + 1 < chunks ? D(size * (k + 1)) : n;
+		};
+
+		std::vector<D> mids(chunks);
+		{
+			detail::task_group tasks;
+			for (std::ptrdiff_t k = 0; k < chunks; ++k) {
+				tasks.run([&, k] {
+					mids[k] = D(__stl2::partition(first + D(size * k), first + block_end(k),
+						__stl2::ref(pred), __stl2::ref(proj)) - first);
+				});
+			}
+			tasks.wait();
+		}
+
+		D m = 0;
+		for (std::ptrdiff_t k = 0; k < chunks; ++k) {
+			m += mids[k] - D(size * k);
+		}
+		// Blocks of elements that fail pred before m, and of elements
+		// that satisfy it after m. Both total the same length.
+		using block = std::pair<D, D>;
+		std::vector<block> wrong_left, wrong_right;
+		D misplaced = 0;
+		for (std::ptrdiff_t k = 0; k < chunks; ++k) {
+			if (mids[k] < m) {
+				const auto e = __stl2::min(block_end(k), m);
+				if (mids[k] < e) {
+					wrong_left.emplace_back(mids[k], e);
+					misplaced += e - mids[k];
+				}
+			}
+			const auto b = __stl2::max(D(size * k), m);
+			if (b < mids[k]) {
+				wrong_right.emplace_back(b, mids[k]);
+			}
+		}
+		if (misplaced == 0) {
+			return first + m;
+		}
+
+		// Swap the misplaced elements with offsets [lo, hi) in the
+		// concatenation of each list of blocks.
+		auto swap_misplaced = [&](D lo, D hi) {
+			auto seek = [lo](const std::vector<block>& blocks) {
+				std::size_t i = 0;
+				auto off = lo;
+				while (off >= blocks[i].second - blocks[i].first) {
+					off -= blocks[i].second - blocks[i].first;
+					++i;
+				}
+				return std::pair{i, blocks[i].first + off};
+			};
+			auto [li, l] = seek(wrong_left);
+			auto [ri, r] = seek(wrong_right);
+			for (; lo < hi; ++lo) {
+				iter_swap(first + l, first + r);
+				if (++l == wrong_left[li].second && lo + 1 < hi) {
+					l = wrong_left[++li].first;
+				}
+				if (++r == wrong_right[ri].second && lo + 1 < hi) {
+					r = wrong_right[++ri].first;
+				}
+			}
+		};
+		const auto pieces = __stl2::min(chunks,
+			std::ptrdiff_t((misplaced + parallel_sort_grain - 1) / parallel_sort_grain));
+		detail::task_group tasks;
+		for (std::ptrdiff_t k = 1; k < pieces; ++k) {
+			tasks.run([&, k] {
+				swap_misplaced(D(misplaced * k / pieces), D(misplaced * (k + 1) / pieces));
+			});
+		}
+		swap_misplaced(0, D(misplaced / pieces));
+		tasks.wait();
+		return first + m;
+	}
+
+	template<RandomAccessIterator I, class Comp, class Proj>
+	requires Sortable<I, Comp, Proj>
+	void __sort_fn::parallel_sort_loop(I first, I last, int bad_allowed,
+		std::ptrdiff_t chunks, Comp& comp, Proj& proj)
+	{
+		detail::task_group tasks;
+		while (true) {
+			const auto n = iter_difference_t<I>(last - first);
+			if (n <= parallel_sort_grain || chunks < 2) {
+				sort_random_access(first, last, comp, proj);
+				break;
+			}
+
+			// Partition [next(first), last) about the pivot *first.
+			detail::pdq_partition::choose_pivot(first, last, comp, proj);
+			auto&& pivot = __stl2::invoke(proj, *first);
+			auto less_than_pivot = [&](auto&& x) -> bool {
+				return __stl2::invoke(comp, x, pivot);
+			};
+			I pivot_pos = prev(parallel_partition(next(first), last,
+				less_than_pivot, proj, chunks));
+			if (pivot_pos == first) {
+				// No element is less than the pivot: put all elements
+				// equivalent to it in place at once.
+				auto not_greater = [&](auto&& x) -> bool {
+					return !__stl2::invoke(comp, pivot, x);
+				};
+				first = parallel_partition(next(first), last,
+					not_greater, proj, chunks);
+				continue;
+			}
+			iter_swap(first, pivot_pos);
+
+			const auto l_size = iter_difference_t<I>(pivot_pos - first);
+			const auto r_size = iter_difference_t<I>(last - next(pivot_pos));
+			if (l_size < n / 8 || r_size < n / 8) {
+				if (--bad_allowed == 0) {
+					sort_random_access(first, last, comp, proj);
+					break;
+				}
+				break_patterns(first, pivot_pos);
+				break_patterns(next(pivot_pos), last);
+			}
+
+			// Share the tasks out in proportion to the partition sizes.
+			const auto l_chunks = std::ptrdiff_t(chunks * (l_size / double(n)));
+			tasks.run([=, &comp, &proj] {
+				parallel_sort_loop(first, pivot_pos, bad_allowed, l_chunks, comp, proj);
+			});
+			first = next(pivot_pos);
+			chunks -= l_chunks;
+		}
+		tasks.wait();
+	}
+
+	template<RandomAccessIterator I, class Comp, class Proj>
+	requires Sortable<I, Comp, Proj>
+	void __sort_fn::parallel_sort(I first, I last, Comp& comp, Proj& proj)
+	{
+		// Over-decompose so that tasks can be balanced.
+		const auto chunks = std::ptrdiff_t(
+			4 * detail::thread_pool::instance().concurrency());
+		parallel_sort_loop(first, last, log2(last - first), chunks, comp, proj);
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
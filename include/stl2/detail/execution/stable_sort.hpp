@@ -0,0 +1,118 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_STABLE_SORT_HPP
+#define STL2_DETAIL_EXECUTION_STABLE_SORT_HPP
+
+#include <cstddef>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/merge.hpp>
+#include <stl2/detail/algorithm/min.hpp>
+#include <stl2/detail/algorithm/move.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/execution/merge_path.hpp>
+#include <stl2/detail/execution/thread_pool.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// stable_sort with an execution policy [Extension]
+//
+// The parallel merge sort that <stl2/detail/algorithm/stable_sort.hpp>
+// declares.
+//
+STL2_OPEN_NAMESPACE {
+	template<RandomAccessIterator I, RandomAccessIterator O, class C, class P>
+	requires Sortable<I, C, P> && IndirectlyMovable<I, O>
+	void __stable_sort_fn::parallel_merge(I first, I middle, I last, O out,
+		std::ptrdiff_t chunks, C &comp, P &proj)
+	{
+		using D = iter_difference_t<I>;
+		const auto n1 = D(middle - first);
+		const auto n2 = D(last - middle);
+		const auto n = D(n1 + n2);
+		chunks = __stl2::min(chunks, std::ptrdiff_t((n + parallel_sort_grain - 1) / parallel_sort_grain));
+		// Find every split before any element is moved from.
+		const auto splits = detail::merge_splits(first, n1, middle, n2,
+			chunks, false, comp, proj, proj);
+		detail::parallel_for(chunks, [&](const std::ptrdiff_t k) {
+			const auto [i, j] = splits[k];
+			const auto [i_end, j_end] = splits[k + 1];
+			merge(
+				__stl2::make_move_iterator(first + i),
+				__stl2::make_move_iterator(first + i_end),
+				__stl2::make_move_iterator(middle + j),
+				__stl2::make_move_iterator(middle + j_end),
+				out + (i + j), __stl2::ref(comp),
+				__stl2::ref(proj), __stl2::ref(proj));
+		});
+	}
+
+	template<RandomAccessIterator I, RandomAccessIterator O, class C, class P>
+	requires Sortable<I, C, P> && Sortable<O, C, P> &&
+		IndirectlyMovable<I, O> && IndirectlyMovable<O, I>
+	void __stable_sort_fn::parallel_merge_sort(I src, O dst, iter_difference_t<I> n,
+		bool to_dst, std::ptrdiff_t chunks, C &comp, P &proj)
+	{
+		if (n <= parallel_sort_grain || chunks < 2) {
+			stable_sort_random_access(src, src + n, comp, proj);
+			if (to_dst) {
+				move(src, src + n, dst);
+			}
+			return;
+		}
+		const auto h = iter_difference_t<I>(n / 2);
+		{
+			detail::task_group tasks;
+			tasks.run([=, &comp, &proj] {
+				parallel_merge_sort(src, dst, h, !to_dst, chunks / 2, comp, proj);
+			});
+			parallel_merge_sort(src + h, dst + h, n - h, !to_dst,
+				chunks - chunks / 2, comp, proj);
+			tasks.wait();
+		}
+		if (to_dst) {
+			parallel_merge(src, src + h, src + n, dst, chunks, comp, proj);
+		} else {
+			parallel_merge(dst, dst + h, dst + n, src, chunks, comp, proj);
+		}
+	}
+
+	template<RandomAccessIterator I, class C, class P>
+	requires Sortable<I, C, P>
+	void __stable_sort_fn::parallel_stable_sort(I first, I last, C &comp, P &proj) {
+		using T = iter_value_t<I>;
+		const auto n = iter_difference_t<I>(last - first);
+		const auto chunks = std::ptrdiff_t(
+			4 * detail::thread_pool::instance().concurrency());
+		buf_t<I> buf{n};
+		if (buf.size() < n) {
+			stable_sort_random_access(first, last, comp, proj);
+			return;
+		}
+		// Move the elements into the buffer, then sort them back.
+		T* const tmp = buf.data();
+		std::ptrdiff_t constructed = 0;
+		struct guard {
+			T* first;
+			std::ptrdiff_t& n;
+			~guard() {
+				for (std::ptrdiff_t i = 0; i < n; ++i) {
+					detail::destruct(first[i]);
+				}
+			}
+		} g{tmp, constructed};
+		for (; constructed < n; ++constructed) {
+			detail::construct(tmp[constructed], iter_move(first + constructed));
+		}
+		parallel_merge_sort(tmp, first, n, true, chunks, comp, proj);
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,237 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_THREAD_POOL_HPP
+#define STL2_DETAIL_EXECUTION_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stl2/detail/fwd.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Work-stealing thread pool for the parallel algorithms
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// A fixed set of worker threads, each owning a double-ended task
+		// queue. A thread pushes and pops tasks at the back of its own queue
+		// - so fork-join recursion proceeds depth-first - and steals from the
+		// front of the others' - taking the oldest, and so largest, tasks.
+		// Threads outside the pool submit to a shared queue.
+		class thread_pool {
+			using task = std::function<void()>;
+
+			struct queue {
+				std::mutex mtx;
+				std::deque<task> tasks;
+			};
+
+			// queues_[0] is the shared queue; queues_[i + 1] belongs to
+			// workers_[i].
+			const std::size_t queue_count_;
+			std::unique_ptr<queue[]> queues_;
+			std::vector<std::thread> workers_;
+			std::mutex mtx_;
+			std::condition_variable cv_;
+			std::atomic<std::ptrdiff_t> queued_{0};
+			bool stop_ = false;
+
+			static std::size_t& this_queue() noexcept {
+				static thread_local std::size_t index = 0;
+				return index;
+			}
+
+			bool try_pop(std::size_t i, task& t, bool back) {
+				auto& q = queues_[i];
+				std::lock_guard<std::mutex> lock{q.mtx};
+				if (q.tasks.empty()) {
+					return false;
+				}
+				if (back) {
+					t = std::move(q.tasks.back());
+					q.tasks.pop_back();
+				} else {
+					t = std::move(q.tasks.front());
+					q.tasks.pop_front();
+				}
+				queued_.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+
+			void work(std::size_t index) {
+				this_queue() = index;
+				while (true) {
+					if (run_one()) {
+						continue;
+					}
+					std::unique_lock<std::mutex> lock{mtx_};
+					cv_.wait(lock, [this] {
+						return stop_ || queued_.load(std::memory_order_relaxed) > 0;
+					});
+					if (stop_) {
+						return;
+					}
+				}
+			}
+
+		public:
+			explicit thread_pool(std::size_t threads)
+			: queue_count_{threads + 1}, queues_{new queue[threads + 1]}
+			{
+				workers_.reserve(threads);
+				for (std::size_t i = 0; i < threads; ++i) {
+					workers_.emplace_back([this, i] { work(i + 1); });
+				}
+			}
+
+			~thread_pool() {
+				{
+					std::lock_guard<std::mutex> lock{mtx_};
+					stop_ = true;
+				}
+				cv_.notify_all();
+				for (auto& w : workers_) {
+					w.join();
+				}
+			}
+
+			thread_pool(const thread_pool&) = delete;
+			thread_pool& operator=(const thread_pool&) = delete;
+
+			// The pool shared by all parallel algorithms: one worker per
+			// hardware thread, less the calling thread - which helps while it
+			// waits.
+			static thread_pool& instance() {
+				static thread_pool pool{[] {
+					const auto n = std::thread::hardware_concurrency();
+					return n > 1 ? std::size_t{n - 1} : std::size_t{1};
+				}()};
+				return pool;
+			}
+
+			// The number of threads that may run tasks concurrently.
+			std::size_t concurrency() const noexcept {
+				return queue_count_;
+			}
+
+			void submit(task t) {
+				auto& q = queues_[this_queue()];
+				{
+					std::lock_guard<std::mutex> lock{q.mtx};
+					q.tasks.push_back(std::move(t));
+				}
+				queued_.fetch_add(1, std::memory_order_relaxed);
+				{
+					// Synchronize with a worker about to wait.
+					std::lock_guard<std::mutex> lock{mtx_};
+				}
+				cv_.notify_one();
+			}
+
+			// Runs one queued task, preferring the newest task in this
+			// thread's queue, then the oldest in any other. Returns false if
+			// there was nothing to run.
+			bool run_one() {
+				const std::size_t self = this_queue();
+				const std::size_t n = queue_count_;
+				task t;
+				bool found = try_pop(self, t, true);
+				for (std::size_t i = 1; !found && i < n; ++i) {
+					found = try_pop((self + i) % n, t, false);
+				}
+				if (found) {
+					t();
+				}
+				return found;
+			}
+		};
+
+		// Fork-join scope: run() queues a task on the pool, and wait() blocks
+		// - running queued tasks meanwhile - until all of them have finished.
+		// The first exception thrown by a task is rethrown by wait().
+		class task_group {
+			thread_pool& pool_;
+			std::atomic<std::ptrdiff_t> pending_{0};
+			std::mutex mtx_;
+			std::exception_ptr error_;
+
+		public:
+			explicit task_group(thread_pool& pool = thread_pool::instance()) noexcept
+			: pool_{pool} {}
+
+			task_group(const task_group&) = delete;
+			task_group& operator=(const task_group&) = delete;
+
+			~task_group() {
+				// Tasks refer to this group and its caller's frame.
+				while (pending_.load(std::memory_order_acquire) != 0) {
+					if (!pool_.run_one()) {
+						std::this_thread::yield();
+					}
+				}
+			}
+
+			template<class F>
+			void run(F f) {
+				pending_.fetch_add(1, std::memory_order_relaxed);
+				try {
+					pool_.submit([this, f = std::move(f)]() mutable {
+						try {
+							f();
+						} catch (...) {
+							std::lock_guard<std::mutex> lock{mtx_};
+							if (!error_) {
+								error_ = std::current_exception();
+							}
+						}
+						pending_.fetch_sub(1, std::memory_order_release);
+					});
+				} catch (...) {
+					pending_.fetch_sub(1, std::memory_order_relaxed);
+					throw;
+				}
+			}
+
+			void wait() {
+				while (pending_.load(std::memory_order_acquire) != 0) {
+					if (!pool_.run_one()) {
+						std::this_thread::yield();
+					}
+				}
+				if (error_) {
+					std::rethrow_exception(std::exchange(error_, nullptr));
+				}
+			}
+		};
+
+		// Runs f(0), ..., f(n - 1) as concurrent tasks - f(0) on the calling
+		// thread - and waits for all of them.
+		template<class F>
+		void parallel_for(const std::ptrdiff_t n, F f) {
+			task_group tasks;
+			for (std::ptrdiff_t k = 1; k < n; ++k) {
+				tasks.run([&f, k] { f(k); });
+			}
+			if (n > 0) {
+				f(0);
+			}
+			tasks.wait();
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
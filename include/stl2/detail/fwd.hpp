@@ -24,6 +24,9 @@
  #define STL2_HAS_BUILTIN(X) STL2_HAS_BUILTIN_ ## X
  #if defined(__GNUC__)
   #define STL2_HAS_BUILTIN_unreachable 1
+  #if __GNUC__ >= 9
+   #define STL2_HAS_BUILTIN_is_constant_evaluated 1
+  #endif
  #endif // __GNUC__
 #endif // __clang__
 
@@ -192,6 +195,20 @@ STL2_OPEN_NAMESPACE {
 		inline constexpr priority_tag<4> max_priority_tag{};
 	}
 
+	namespace detail {
+		// True during constant evaluation. The supported compilers - GCC 9
+		// and later - tell us; any other is assumed to be constant
+		// evaluating, which disables every fast path this guards, so this
+		// may only guard optimizations, never observable behavior.
+		constexpr bool is_constant_evaluated() noexcept {
+#if STL2_HAS_BUILTIN(is_constant_evaluated)
+			return __builtin_is_constant_evaluated();
+#else
+			return true;
+#endif
+		}
+	}
+
 	struct __niebloid {
 		explicit __niebloid() = default;
 		__niebloid(const __niebloid&) = delete;
@@ -14,6 +14,7 @@
 #define STL2_DETAIL_MEMORY_UNINITIALIZED_COPY_HPP
 
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/memory/concepts.hpp>
 #include <stl2/detail/memory/construct_at.hpp>
@@ -31,6 +32,14 @@ STL2_OPEN_NAMESPACE {
 		template<InputIterator I, Sentinel<I> S1, _NoThrowForwardIterator O, _NoThrowSentinel<O> S2>
 		requires Constructible<iter_value_t<O>, iter_reference_t<I>>
 		uninitialized_copy_result<I, O> operator()(I ifirst, S1 ilast, O ofirst, S2 olast) const {
+			if constexpr (SizedSentinel<S1, I> && SizedSentinel<S2, O> &&
+				detail::__memmove_constructible<I, O, iter_reference_t<I>>)
+			{
+				// No constructor can throw: no guard
+				const auto n1 = ilast - ifirst;
+				const auto n2 = static_cast<iter_difference_t<I>>(olast - ofirst);
+				return detail::bulk_copy(ifirst, n1 < n2 ? n1 : n2, ofirst);
+			}
 			auto guard = detail::destroy_guard{ofirst};
 			for (; ifirst != ilast && ofirst != olast; (void) ++ifirst, (void)++ofirst) {
 				__stl2::__construct_at(*ofirst, *ifirst);
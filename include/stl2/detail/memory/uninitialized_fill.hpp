@@ -15,6 +15,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_fill.hpp>
 #include <stl2/detail/memory/concepts.hpp>
 #include <stl2/detail/memory/construct_at.hpp>
 #include <stl2/detail/memory/destroy.hpp>
@@ -27,6 +28,9 @@ STL2_OPEN_NAMESPACE {
 		template<_NoThrowForwardIterator I, _NoThrowSentinel<I> S, class T>
 		requires Constructible<iter_value_t<I>, const T&>
 		I operator()(I first, S last, const T& x) const {
+			if constexpr (SizedSentinel<S, I> && detail::__memconstructible<I, T>) {
+				return detail::bulk_fill(first, last - first, x);
+			}
 			auto guard = detail::destroy_guard{first};
 			for (; first != last; ++first) {
 				__stl2::__construct_at(*first, x);
@@ -0,0 +1,125 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_UNINITIALIZED_RELOCATE_HPP
+#define STL2_DETAIL_MEMORY_UNINITIALIZED_RELOCATE_HPP
+
+#include <memory>
+#include <type_traits>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_copy.hpp>
+#include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/memory/concepts.hpp>
+#include <stl2/detail/memory/construct_at.hpp>
+#include <stl2/detail/memory/destroy.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// uninitialized_relocate [Extension]
+//
+// Moves each element of a range into uninitialized memory and destroys
+// the original, in one pass, as when a vector grows into a new buffer.
+// The ranges must not overlap. If a move constructor throws, the objects
+// constructed in the output and the elements of the input that were yet
+// to be relocated are destroyed: none of the input is left.
+//
+// Types whose objects can be relocated by copying their bytes, and
+// forgetting the originals, are trivially relocatable: those that are
+// trivially move constructible and trivially destructible, and those for
+// which users specialize ext::enable_trivially_relocatable. Contiguous
+// ranges of them are relocated with a single memmove.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class T>
+		inline constexpr bool enable_trivially_relocatable =
+			std::is_trivially_move_constructible_v<T> &&
+			std::is_trivially_destructible_v<T>;
+	}
+
+	namespace detail {
+		// Relocating the elements of I to the elements of O copies their
+		// bytes in the same order.
+		template<class I, class O>
+		META_CONCEPT __memrelocatable =
+			ContiguousIterator<__bulk_t<I>> && ContiguousIterator<__bulk_t<O>> &&
+			__bulk<I>::reversed == __bulk<O>::reversed &&
+			Same<iter_value_t<__bulk_t<I>>, iter_value_t<__bulk_t<O>>> &&
+			ext::enable_trivially_relocatable<iter_value_t<__bulk_t<I>>> &&
+			!std::is_volatile_v<std::remove_reference_t<iter_reference_t<__bulk_t<I>>>> &&
+			!std::is_volatile_v<std::remove_reference_t<iter_reference_t<__bulk_t<O>>>>;
+	}
+
+	namespace ext {
+		template<class I, class O>
+		using uninitialized_relocate_result = __in_out_result<I, O>;
+
+		struct __uninitialized_relocate_fn : private __niebloid {
+			template<_NoThrowForwardIterator I, _NoThrowSentinel<I> S1,
+				_NoThrowForwardIterator O, _NoThrowSentinel<O> S2>
+			requires Constructible<iter_value_t<O>, iter_rvalue_reference_t<I>> &&
+				Destructible<iter_value_t<I>>
+			uninitialized_relocate_result<I, O>
+			operator()(I ifirst, S1 ilast, O ofirst, S2 olast) const {
+				if constexpr (SizedSentinel<S1, I> && SizedSentinel<S2, O> &&
+					detail::__memrelocatable<I, O>)
+				{
+					const auto n1 = ilast - ifirst;
+					const auto n2 = static_cast<iter_difference_t<I>>(olast - ofirst);
+					return detail::bulk_copy(ifirst, n1 < n2 ? n1 : n2, ofirst);
+				}
+				auto guard = detail::destroy_guard{ofirst};
+				try {
+					for (; ifirst != ilast && ofirst != olast; (void) ++ifirst, (void) ++ofirst) {
+						__stl2::__construct_at(*ofirst, iter_move(ifirst));
+						destroy_at(std::addressof(*ifirst));
+					}
+				} catch(...) {
+					for (auto o = ofirst; ifirst != ilast && o != olast; (void) ++ifirst, (void) ++o) {
+						destroy_at(std::addressof(*ifirst));
+					}
+					throw;
+				}
+				guard.release();
+				return {std::move(ifirst), std::move(ofirst)};
+			}
+
+			template<_NoThrowForwardRange IR, _NoThrowForwardRange OR>
+			requires Constructible<iter_value_t<iterator_t<OR>>,
+			                       iter_rvalue_reference_t<iterator_t<IR>>> &&
+				Destructible<iter_value_t<iterator_t<IR>>>
+			uninitialized_relocate_result<safe_iterator_t<IR>, safe_iterator_t<OR>>
+			operator()(IR&& in, OR&& out) const {
+				return (*this)(begin(in), end(in), begin(out), end(out));
+			}
+		};
+
+		inline constexpr __uninitialized_relocate_fn uninitialized_relocate {};
+
+		template<class I, class O>
+		using uninitialized_relocate_n_result = __in_out_result<I, O>;
+
+		struct __uninitialized_relocate_n_fn : private __niebloid {
+			template<_NoThrowForwardIterator I, _NoThrowForwardIterator O,
+				_NoThrowSentinel<O> S>
+			requires Constructible<iter_value_t<O>, iter_rvalue_reference_t<I>> &&
+				Destructible<iter_value_t<I>>
+			uninitialized_relocate_n_result<I, O>
+			operator()(I ifirst, iter_difference_t<I> n, O ofirst, S olast) const {
+				auto [in, out] = uninitialized_relocate(counted_iterator{std::move(ifirst), n},
+					default_sentinel{}, std::move(ofirst), std::move(olast));
+				return {in.base(), std::move(out)};
+			}
+		};
+
+		inline constexpr __uninitialized_relocate_n_fn uninitialized_relocate_n {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif // STL2_DETAIL_MEMORY_UNINITIALIZED_RELOCATE_HPP
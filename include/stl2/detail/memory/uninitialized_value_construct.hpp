@@ -15,6 +15,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/bulk_fill.hpp>
 #include <stl2/detail/memory/concepts.hpp>
 #include <stl2/detail/memory/construct_at.hpp>
 #include <stl2/detail/memory/destroy.hpp>
@@ -27,6 +28,14 @@ STL2_OPEN_NAMESPACE {
 		template<_NoThrowForwardIterator I, _NoThrowSentinel<I> S>
 		requires DefaultConstructible<iter_value_t<I>>
 		I operator()(I first, S last) const {
+			using V = iter_value_t<I>;
+			if constexpr (SizedSentinel<S, I> && detail::__memconstructible<I, V> &&
+				std::is_trivially_default_constructible_v<V>)
+			{
+				// Value-initialization zeroes V, whatever the representation
+				// of its zero.
+				return detail::bulk_fill(first, last - first, V{});
+			}
 			auto guard = detail::destroy_guard{first};
 			for (; first != last; ++first) {
 				__stl2::__construct_at(*first);
@@ -0,0 +1,179 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_NONTEMPORAL_HPP
+#define STL2_DETAIL_NONTEMPORAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stl2/detail/fwd.hpp>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Non-temporal stores [Implementation detail]
+//
+// Stores that write whole lines of memory around the caches (MOVNT on
+// x86), for writes of buffers larger than the last-level cache, which
+// would otherwise evict the rest of the working set to make room for data
+// that isn't read again soon. The stores are weakly ordered: each kernel
+// ends with a store fence, after which they are ordered as usual. Targets
+// without them use regular stores.
+//
+// Copies, moves and fills of contiguous trivially copyable objects use
+// non-temporal stores from STL2_NONTEMPORAL_THRESHOLD bytes; the default,
+// 0, leaves them to ext::stream_copy and ext::stream_fill. (glibc's memmove
+// switches to non-temporal stores for copies much larger than its share of
+// the last-level cache by itself.)
+//
+#ifndef STL2_NONTEMPORAL_THRESHOLD
+#define STL2_NONTEMPORAL_THRESHOLD 0
+#endif
+
+STL2_OPEN_NAMESPACE {
+	namespace detail::nontemporal {
+#if defined(__AVX512F__)
+		inline constexpr std::size_t bytes = 64;
+		using block = __m512i;
+		inline block load(const void* p) noexcept {
+			return _mm512_loadu_si512(p);
+		}
+		inline void store(void* p, const block b) noexcept {
+			_mm512_stream_si512(static_cast<block*>(p), b);
+		}
+#elif defined(__AVX__)
+		inline constexpr std::size_t bytes = 32;
+		using block = __m256i;
+		inline block load(const void* p) noexcept {
+			return _mm256_loadu_si256(static_cast<const block*>(p));
+		}
+		inline void store(void* p, const block b) noexcept {
+			_mm256_stream_si256(static_cast<block*>(p), b);
+		}
+#elif defined(__SSE2__)
+		inline constexpr std::size_t bytes = 16;
+		using block = __m128i;
+		inline block load(const void* p) noexcept {
+			return _mm_loadu_si128(static_cast<const block*>(p));
+		}
+		inline void store(void* p, const block b) noexcept {
+			_mm_stream_si128(static_cast<block*>(p), b);
+		}
+#else
+		inline constexpr std::size_t bytes = 0;
+#endif
+		// Whether the target has non-temporal stores.
+		inline constexpr bool available = bytes != 0;
+
+		inline constexpr std::size_t threshold = STL2_NONTEMPORAL_THRESHOLD;
+
+		// Whether copies and fills of size bytes use non-temporal stores.
+		constexpr bool over_threshold([[maybe_unused]] const std::size_t size) noexcept {
+			if constexpr (threshold == 0) {
+				return false;
+			} else {
+				return size >= threshold;
+			}
+		}
+
+		// Whether the size bytes at p and q overlap.
+		inline bool overlap(const void* const p, const void* const q,
+			const std::size_t size) noexcept
+		{
+			const auto a = reinterpret_cast<std::uintptr_t>(p);
+			const auto b = reinterpret_cast<std::uintptr_t>(q);
+			return a < b ? b - a < size : a - b < size;
+		}
+
+#if defined(__SSE2__)
+		// The number of bytes from p to the next boundary of a block, up to
+		// size.
+		inline std::size_t head(const void* const p, const std::size_t size) noexcept {
+			const auto misalignment = reinterpret_cast<std::uintptr_t>(p) % bytes;
+			const std::size_t n = misalignment == 0 ? 0 : bytes - misalignment;
+			return n < size ? n : size;
+		}
+#endif
+
+		// Copies size bytes from src to dst, which don't overlap.
+		inline void copy(void* const dst, const void* const src, std::size_t size) noexcept {
+#if defined(__SSE2__)
+			auto d = static_cast<unsigned char*>(dst);
+			auto s = static_cast<const unsigned char*>(src);
+			// Regular stores up to the first block of dst
+			const auto n = head(d, size);
+			std::memcpy(d, s, n);
+			d += n;
+			s += n;
+			size -= n;
+			// Four blocks at a time, to keep the loads ahead of the stores
+			for (; size >= 4 * bytes; size -= 4 * bytes) {
+				const auto b0 = load(s);
+				const auto b1 = load(s + bytes);
+				const auto b2 = load(s + 2 * bytes);
+				const auto b3 = load(s + 3 * bytes);
+				store(d, b0);
+				store(d + bytes, b1);
+				store(d + 2 * bytes, b2);
+				store(d + 3 * bytes, b3);
+				d += 4 * bytes;
+				s += 4 * bytes;
+			}
+			for (; size >= bytes; size -= bytes) {
+				store(d, load(s));
+				d += bytes;
+				s += bytes;
+			}
+			_mm_sfence();
+			std::memcpy(d, s, size);
+#else
+			std::memcpy(dst, src, size);
+#endif
+		}
+
+		// Stores n copies of the object representation of value from p.
+		template<class T>
+		void fill(T* const p, const std::size_t n, const T& value) noexcept {
+#if defined(__SSE2__)
+			if constexpr (bytes % sizeof(T) == 0) {
+				// The bytes of the copies, from p, for any block: the block
+				// at d starts at pattern + (d - p) % sizeof(T).
+				unsigned char pattern[2 * bytes];
+				for (std::size_t i = 0; i < sizeof(pattern); i += sizeof(T)) {
+					std::memcpy(pattern + i, std::addressof(value), sizeof(T));
+				}
+				auto d = reinterpret_cast<unsigned char*>(p);
+				std::size_t size = n * sizeof(T);
+				const auto k = head(d, size);
+				std::memcpy(d, pattern, k);
+				d += k;
+				size -= k;
+				const auto phase = pattern + k % sizeof(T);
+				const auto b = load(phase);
+				for (; size >= bytes; size -= bytes) {
+					store(d, b);
+					d += bytes;
+				}
+				_mm_sfence();
+				std::memcpy(d, phase, size);
+				return;
+			}
+#endif
+			for (std::size_t i = 0; i < n; ++i) {
+				p[i] = value;
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
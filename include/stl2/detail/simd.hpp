@@ -0,0 +1,355 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_SIMD_HPP
+#define STL2_DETAIL_SIMD_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Vectors of arithmetic values [Implementation detail]
+//
+// The vectors are those of the GCC and Clang vector extensions, which the
+// compiler lowers to the instructions of the target: the vectors are as
+// wide as the widest registers that -march enables - 64 bytes with
+// AVX-512BW, 32 with AVX2, and 16 otherwise, as with SSE2 and NEON. Where
+// the operation is an arbitrary predicate, loops over blocks of elements
+// leave the vectorization to the compiler. None of this is constexpr:
+// callers guard their uses with detail::is_constant_evaluated.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail::simd {
+		// The size in bytes of a vector.
+#if defined(__AVX512BW__)
+		inline constexpr std::size_t bytes = 64;
+#elif defined(__AVX2__)
+		inline constexpr std::size_t bytes = 32;
+#else
+		inline constexpr std::size_t bytes = 16;
+#endif
+
+		template<class T>
+		META_CONCEPT lane = std::is_arithmetic_v<T> && !Same<T, bool>;
+
+		template<lane T>
+		struct vector_ {
+			// GCC ignores the attribute on an alias template.
+			typedef T type __attribute__((vector_size(bytes)));
+		};
+
+		template<lane T>
+		using vector = typename vector_<T>::type;
+
+		// The elements of I are contiguous numbers, which vectors can load.
+		template<class I>
+		META_CONCEPT __contiguous_lanes = ContiguousIterator<I> &&
+			lane<iter_value_t<I>> &&
+			!std::is_volatile_v<std::remove_reference_t<iter_reference_t<I>>>;
+
+		// The number of lanes in a vector of T.
+		template<lane T>
+		inline constexpr std::ptrdiff_t width = bytes / sizeof(T);
+
+		template<lane T>
+		inline vector<T> load(const T* p) noexcept {
+			vector<T> v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		template<lane T>
+		inline vector<T> broadcast(const T x) noexcept {
+			return vector<T>{} + x;
+		}
+
+		// The results of comparisons of vectors, whose lanes are all ones
+		// where true and zero where false, viewed as words.
+		template<class M>
+		struct mask_words {
+			static_assert(sizeof(M) % sizeof(unsigned long long) == 0);
+			static constexpr int lane_bits = CHAR_BIT * sizeof(M{}[0]);
+			unsigned long long words[sizeof(M) / sizeof(unsigned long long)];
+
+			explicit mask_words(const M& m) noexcept {
+				std::memcpy(words, &m, sizeof(M));
+			}
+		};
+
+		// Whether any lane of m, the result of a comparison, is true.
+		template<class M>
+		inline bool any(const M& m) noexcept {
+			const mask_words<M> mw{m};
+			unsigned long long bits = 0;
+			for (auto w : mw.words) {
+				bits |= w;
+			}
+			return bits != 0;
+		}
+
+		// The index of the first true lane of m, the result of a
+		// comparison, which must have one.
+		template<class M>
+		inline std::ptrdiff_t first(const M& m) noexcept {
+			const mask_words<M> mw{m};
+			std::ptrdiff_t i = 0;
+			for (auto w : mw.words) {
+				if (w != 0) {
+					return (i + __builtin_ctzll(w)) / mw.lane_bits;
+				}
+				i += CHAR_BIT * sizeof(w);
+			}
+			STL2_EXPECT(false);
+			return 0;
+		}
+
+		// The index of the last true lane of m, the result of a comparison,
+		// which must have one.
+		template<class M>
+		inline std::ptrdiff_t last(const M& m) noexcept {
+			const mask_words<M> mw{m};
+			constexpr std::ptrdiff_t word_bits = CHAR_BIT * sizeof(mw.words[0]);
+			for (std::ptrdiff_t j = sizeof(mw.words) / sizeof(mw.words[0]); j-- > 0;) {
+				if (const auto w = mw.words[j]; w != 0) {
+					return (j * word_bits + word_bits - 1 - __builtin_clzll(w)) / mw.lane_bits;
+				}
+			}
+			STL2_EXPECT(false);
+			return 0;
+		}
+
+		// Elements of type V that equal a value of type T are those equal
+		// to static_cast<V>(value), if that equals value: vectors of V can
+		// look for value. (Both comparisons convert the element to the same
+		// common type, which holds every value of V.)
+		template<class V, class T>
+		META_CONCEPT __searchable = lane<V> &&
+			(Same<V, T> || (std::is_integral_v<V> && std::is_integral_v<T> &&
+				!Same<T, bool>));
+
+		// Returns the index of the first of the n elements at p equal to v,
+		// or n.
+		template<lane V>
+		std::ptrdiff_t find(const V* const p, const std::ptrdiff_t n, const V v) noexcept {
+			constexpr std::ptrdiff_t w = width<V>;
+			const auto k = broadcast(v);
+			std::ptrdiff_t i = 0;
+			// Four vectors at a time, to hide the latency of the test
+			for (; i + 4 * w <= n; i += 4 * w) {
+				const auto m0 = load(p + i) == k;
+				const auto m1 = load(p + i + w) == k;
+				const auto m2 = load(p + i + 2 * w) == k;
+				const auto m3 = load(p + i + 3 * w) == k;
+				if (any((m0 | m1) | (m2 | m3))) {
+					if (any(m0)) return i + first(m0);
+					if (any(m1)) return i + w + first(m1);
+					if (any(m2)) return i + 2 * w + first(m2);
+					return i + 3 * w + first(m3);
+				}
+			}
+			for (; i + w <= n; i += w) {
+				const auto m = load(p + i) == k;
+				if (any(m)) {
+					return i + first(m);
+				}
+			}
+			for (; i < n; ++i) {
+				if (p[i] == v) {
+					break;
+				}
+			}
+			return i;
+		}
+
+		// Returns the index of the first of the n elements at p not equal
+		// to v, or n.
+		template<lane V>
+		std::ptrdiff_t find_not(const V* const p, const std::ptrdiff_t n, const V v) noexcept {
+			constexpr std::ptrdiff_t w = width<V>;
+			const auto k = broadcast(v);
+			std::ptrdiff_t i = 0;
+			for (; i + w <= n; i += w) {
+				const auto m = load(p + i) != k;
+				if (any(m)) {
+					return i + first(m);
+				}
+			}
+			for (; i < n; ++i) {
+				if (!(p[i] == v)) {
+					break;
+				}
+			}
+			return i;
+		}
+
+		// Returns the number of the last of the n elements at p that are
+		// equal to v, after the last that isn't.
+		template<lane V>
+		std::ptrdiff_t count_back(const V* const p, const std::ptrdiff_t n, const V v) noexcept {
+			constexpr std::ptrdiff_t w = width<V>;
+			const auto k = broadcast(v);
+			std::ptrdiff_t i = n;
+			for (; i >= w; i -= w) {
+				const auto m = load(p + i - w) != k;
+				if (any(m)) {
+					return n - (i - w + last(m) + 1);
+				}
+			}
+			for (; i > 0; --i) {
+				if (!(p[i - 1] == v)) {
+					break;
+				}
+			}
+			return n - i;
+		}
+
+		// Returns the number of the n elements at p equal to v.
+		template<lane V>
+		std::ptrdiff_t count(const V* const p, const std::ptrdiff_t n, const V v) noexcept {
+			constexpr std::ptrdiff_t w = width<V>;
+			using M = decltype(vector<V>{} == vector<V>{});
+			using L = std::make_unsigned_t<std::remove_reference_t<decltype(M{}[0])>>;
+			// The lanes of the running sums count up to this many matches
+			// before they are added to the result.
+			constexpr std::ptrdiff_t max_block =
+				std::numeric_limits<L>::max() < std::numeric_limits<std::ptrdiff_t>::max() / w
+					? std::ptrdiff_t(std::numeric_limits<L>::max()) * w
+					: std::numeric_limits<std::ptrdiff_t>::max() / w * w;
+			const auto k = broadcast(v);
+			std::ptrdiff_t result = 0;
+			std::ptrdiff_t i = 0;
+			while (i + w <= n) {
+				const auto block_end = n - i < max_block ? i + (n - i) / w * w : i + max_block;
+				// Subtracting a lane of all ones adds one, which is well
+				// defined for unsigned lanes.
+				vector<L> sums{};
+				for (; i < block_end; i += w) {
+					sums -= static_cast<vector<L>>(load(p + i) == k);
+				}
+				for (std::ptrdiff_t j = 0; j < w; ++j) {
+					result += sums[j];
+				}
+			}
+			for (; i < n; ++i) {
+				result += p[i] == v;
+			}
+			return result;
+		}
+
+		// The elements of I1 and I2 are contiguous numbers of the same type,
+		// which pred compares as Op does: vectors can compare the ranges.
+		template<class I1, class I2, class Op, class Pred, class Proj1, class Proj2>
+		META_CONCEPT __comparable_lanes = __contiguous_lanes<I1> &&
+			__contiguous_lanes<I2> && Same<iter_value_t<I1>, iter_value_t<I2>> &&
+			Same<__uncvref<__unwrap<Pred>>, Op> &&
+			Same<__uncvref<__unwrap<Proj1>>, identity> &&
+			Same<__uncvref<__unwrap<Proj2>>, identity>;
+
+		// Returns the index of the first of the n elements at p that isn't
+		// equal to the element at the same index at q, or n.
+		template<lane V>
+		std::ptrdiff_t mismatch(const V* const p, const V* const q,
+			const std::ptrdiff_t n) noexcept
+		{
+			constexpr std::ptrdiff_t w = width<V>;
+			std::ptrdiff_t i = 0;
+			for (; i + 2 * w <= n; i += 2 * w) {
+				const auto m0 = load(p + i) != load(q + i);
+				const auto m1 = load(p + i + w) != load(q + i + w);
+				if (any(m0 | m1)) {
+					if (any(m0)) return i + first(m0);
+					return i + w + first(m1);
+				}
+			}
+			for (; i + w <= n; i += w) {
+				const auto m = load(p + i) != load(q + i);
+				if (any(m)) {
+					return i + first(m);
+				}
+			}
+			for (; i < n; ++i) {
+				if (!(p[i] == q[i])) {
+					break;
+				}
+			}
+			return i;
+		}
+
+		// Whether the n elements at p equal those at q. Integers are equal
+		// exactly when their bytes are, which memcmp compares fastest;
+		// floating-point zeroes and not-a-numbers are not.
+		template<lane V>
+		bool equal(const V* const p, const V* const q, const std::ptrdiff_t n) noexcept {
+			if constexpr (std::is_integral_v<V> && std::has_unique_object_representations_v<V>) {
+				return n == 0 || std::memcmp(p, q, n * sizeof(V)) == 0;
+			} else {
+				return mismatch(p, q, n) == n;
+			}
+		}
+
+		// Whether the n1 elements at p order before the n2 elements at q.
+		// memcmp orders unsigned bytes as < does.
+		template<lane V>
+		bool lexicographical_compare(const V* const p, const std::ptrdiff_t n1,
+			const V* const q, const std::ptrdiff_t n2) noexcept
+		{
+			const auto n = n1 < n2 ? n1 : n2;
+			if constexpr (std::is_unsigned_v<V> && sizeof(V) == 1) {
+				const int c = n == 0 ? 0 : std::memcmp(p, q, n);
+				return c < 0 || (c == 0 && n1 < n2);
+			} else {
+				for (std::ptrdiff_t i = 0; (i += mismatch(p + i, q + i, n - i)) < n; ++i) {
+					if (p[i] < q[i]) return true;
+					if (q[i] < p[i]) return false;
+					// Unordered: a not-a-number is equivalent to anything.
+				}
+				return n1 < n2;
+			}
+		}
+
+		// The elements of I are contiguous numbers no wider than four
+		// bytes, to which count_if applies the predicate a block at a time,
+		// without a branch per element: compilers vectorize that for simple
+		// predicates, such as comparisons with a value. (find_if and the
+		// algorithms built on it stop at the first element that satisfies
+		// the predicate, which mustn't see the elements after it.)
+		template<class I, class S, class Proj>
+		META_CONCEPT __blockwise = __contiguous_lanes<I> && SizedSentinel<S, I> &&
+			sizeof(iter_value_t<I>) <= 4 &&
+			Same<__uncvref<__unwrap<Proj>>, identity>;
+
+		// Returns the number of the n elements at p that satisfy pred.
+		template<class P, class Pred>
+		std::ptrdiff_t count_if(const P p, const std::ptrdiff_t n, Pred& pred) {
+			constexpr std::ptrdiff_t block = 256;
+			std::ptrdiff_t result = 0;
+			std::ptrdiff_t i = 0;
+			for (; i + block <= n; i += block) {
+				unsigned hits = 0;
+				for (std::ptrdiff_t j = 0; j < block; ++j) {
+					hits += static_cast<bool>(__stl2::invoke(pred, p[i + j]));
+				}
+				result += hits;
+			}
+			for (; i < n; ++i) {
+				result += static_cast<bool>(__stl2::invoke(pred, p[i]));
+			}
+			return result;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -159,6 +159,11 @@ STL2_OPEN_NAMESPACE {
 			noexcept(std::is_nothrow_move_constructible<T>::value)
 			requires MoveConstructible<T>
 			{ emplace_back(std::move(t)); }
+			void pop_back() noexcept {
+				STL2_EXPECT(begin_ < end_);
+				--end_;
+				detail::destruct(*end_);
+			}
 		};
 
 		template<ext::DestructibleObject T>
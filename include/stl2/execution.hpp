@@ -0,0 +1,22 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_EXECUTION_HPP
+#define STL2_EXECUTION_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/execution/policy.hpp>
+#include <stl2/detail/execution/inplace_merge.hpp>
+#include <stl2/detail/execution/merge.hpp>
+#include <stl2/detail/execution/set_operations.hpp>
+#include <stl2/detail/execution/sort.hpp>
+#include <stl2/detail/execution/stable_sort.hpp>
+#include <stl2/detail/execution/thread_pool.hpp>
+
+#endif
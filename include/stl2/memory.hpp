@@ -20,6 +20,7 @@
 #include <stl2/detail/memory/uninitialized_default_construct.hpp>
 #include <stl2/detail/memory/uninitialized_fill.hpp>
 #include <stl2/detail/memory/uninitialized_move.hpp>
+#include <stl2/detail/memory/uninitialized_relocate.hpp>
 #include <stl2/detail/memory/uninitialized_value_construct.hpp>
 
 #endif
@@ -36,6 +36,7 @@
 #include <stl2/view/repeat_n.hpp>
 #include <stl2/view/repeat.hpp>
 #include <stl2/view/reverse.hpp>
+#include <stl2/view/set_algorithm.hpp>
 #include <stl2/view/single.hpp>
 #include <stl2/view/split.hpp>
 #include <stl2/view/subrange.hpp>
@@ -0,0 +1,401 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_SET_ALGORITHM_HPP
+#define STL2_VIEW_SET_ALGORITHM_HPP
+
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/cached_position.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/semiregular_box.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// merge_view, set_union_view, set_intersection_view, set_difference_view,
+// and set_symmetric_difference_view [Extensions]
+//
+// Lazy counterparts of merge and the set algorithms: each element is
+// found as the view's iterator is advanced to it, so that a pipeline
+// which reads a prefix of the result reads only as much of the inputs as
+// that prefix needs. The elements are those the algorithm of the same
+// name would write, in the same order.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		enum class __set_op {
+			merge, set_union, set_intersection, set_difference,
+			set_symmetric_difference
+		};
+
+		// Whether the view of the operation yields elements of the second
+		// range as well as of the first.
+		template<__set_op Op>
+		inline constexpr bool __set_op_reads_second =
+			Op == __set_op::merge || Op == __set_op::set_union ||
+			Op == __set_op::set_symmetric_difference;
+
+		// Whether the view of the operation skips elements to find its
+		// next one, so that finding its first is O(n) rather than O(1).
+		template<__set_op Op>
+		inline constexpr bool __set_op_skips =
+			Op == __set_op::set_intersection || Op == __set_op::set_difference ||
+			Op == __set_op::set_symmetric_difference;
+
+		template<__set_op Op, class I1, class I2>
+		struct __set_view_types {
+			using value_type = iter_value_t<I1>;
+			using reference = iter_reference_t<I1>;
+			using rvalue_reference = iter_rvalue_reference_t<I1>;
+		};
+		template<__set_op Op, class I1, class I2>
+		requires __set_op_reads_second<Op>
+		struct __set_view_types<Op, I1, I2> {
+			using value_type = common_type_t<iter_value_t<I1>, iter_value_t<I2>>;
+			using reference = common_reference_t<iter_reference_t<I1>,
+				iter_reference_t<I2>>;
+			using rvalue_reference = common_reference_t<iter_rvalue_reference_t<I1>,
+				iter_rvalue_reference_t<I2>>;
+		};
+
+		template<__set_op Op, class I1, class I2>
+		META_CONCEPT __set_view_readable = !__set_op_reads_second<Op> ||
+			(Common<iter_value_t<I1>, iter_value_t<I2>> &&
+			CommonReference<iter_reference_t<I1>, iter_reference_t<I2>> &&
+			CommonReference<iter_rvalue_reference_t<I1>, iter_rvalue_reference_t<I2>>);
+
+		template<__set_op Op, View V1, View V2, class Comp, class Proj1, class Proj2>
+		requires InputRange<V1> && InputRange<V2> &&
+			std::is_object_v<Comp> && std::is_object_v<Proj1> &&
+			std::is_object_v<Proj2> &&
+			IndirectStrictWeakOrder<Comp, projected<iterator_t<V1>, Proj1>,
+				projected<iterator_t<V2>, Proj2>> &&
+			__set_view_readable<Op, iterator_t<V1>, iterator_t<V2>>
+		class set_algorithm_view
+		: public view_interface<set_algorithm_view<Op, V1, V2, Comp, Proj1, Proj2>> {
+		private:
+			class __iterator;
+			class __sentinel;
+
+			V1 base1_;
+			V2 base2_;
+			detail::semiregular_box<Comp> comp_;
+			detail::semiregular_box<Proj1> proj1_;
+			detail::semiregular_box<Proj2> proj2_;
+
+			// The positions of the first element, cached so that begin is
+			// amortized O(1), as a range's must be.
+			static constexpr bool __caches_begin =
+				__set_op_skips<Op> && ForwardRange<V1> && ForwardRange<V2>;
+			detail::cached_position<V1, set_algorithm_view, __caches_begin> begin1_;
+			detail::cached_position<V2, set_algorithm_view, __caches_begin> begin2_;
+
+		public:
+			set_algorithm_view() = default;
+
+			constexpr set_algorithm_view(V1 base1, V2 base2, Comp comp = {},
+				Proj1 proj1 = {}, Proj2 proj2 = {})
+			: base1_(std::move(base1)), base2_(std::move(base2))
+			, comp_(std::move(comp)), proj1_(std::move(proj1))
+			, proj2_(std::move(proj2)) {}
+
+			constexpr V1 base1() const { return base1_; }
+			constexpr V2 base2() const { return base2_; }
+
+			constexpr __iterator begin()
+			{
+				if (begin1_) {
+					return __iterator{*this, begin1_.get(base1_), begin2_.get(base2_)};
+				}
+				auto first = __iterator{*this, __stl2::begin(base1_), __stl2::begin(base2_)};
+				begin1_.set(base1_, first.base1());
+				begin2_.set(base2_, first.base2());
+				return first;
+			}
+
+			constexpr __sentinel end()
+			{ return __sentinel{*this}; }
+		};
+
+		template<__set_op Op, View V1, View V2, class Comp, class Proj1, class Proj2>
+		requires InputRange<V1> && InputRange<V2> &&
+			std::is_object_v<Comp> && std::is_object_v<Proj1> &&
+			std::is_object_v<Proj2> &&
+			IndirectStrictWeakOrder<Comp, projected<iterator_t<V1>, Proj1>,
+				projected<iterator_t<V2>, Proj2>> &&
+			__set_view_readable<Op, iterator_t<V1>, iterator_t<V2>>
+		class set_algorithm_view<Op, V1, V2, Comp, Proj1, Proj2>::__iterator {
+		private:
+			using I1 = iterator_t<V1>;
+			using I2 = iterator_t<V2>;
+			using types = __set_view_types<Op, I1, I2>;
+			friend __sentinel;
+
+			// The range the current element is read from, or both when it
+			// is one of a pair of equivalent elements, each consumed with the
+			// other. Of a pair, set_union reads the element of the second
+			// range, and set_intersection that of the first, as do the
+			// algorithms.
+			enum class __from : unsigned char { first, second, both };
+
+			set_algorithm_view* parent_ = nullptr;
+			I1 it1_ {};
+			I2 it2_ {};
+			__from from_ = __from::first;
+
+			constexpr bool reads_second() const {
+				return from_ == __from::second ||
+					(Op == __set_op::set_union && from_ == __from::both);
+			}
+
+			constexpr bool less12() const {
+				return __stl2::invoke(parent_->comp_.get(),
+					__stl2::invoke(parent_->proj1_.get(), *it1_),
+					__stl2::invoke(parent_->proj2_.get(), *it2_));
+			}
+			constexpr bool less21() const {
+				return __stl2::invoke(parent_->comp_.get(),
+					__stl2::invoke(parent_->proj2_.get(), *it2_),
+					__stl2::invoke(parent_->proj1_.get(), *it1_));
+			}
+
+			// Advances past the elements the operation drops, and notes
+			// which range holds the next one it keeps.
+			constexpr void satisfy() {
+				const auto last1 = __stl2::end(parent_->base1_);
+				const auto last2 = __stl2::end(parent_->base2_);
+				if constexpr (Op == __set_op::merge) {
+					from_ = it1_ == last1 || (it2_ != last2 && less21())
+						? __from::second : __from::first;
+				} else if constexpr (Op == __set_op::set_union) {
+					if (it1_ == last1) {
+						from_ = __from::second;
+					} else if (it2_ == last2 || less12()) {
+						from_ = __from::first;
+					} else {
+						from_ = less21() ? __from::second : __from::both;
+					}
+				} else if constexpr (Op == __set_op::set_intersection) {
+					while (it1_ != last1 && it2_ != last2) {
+						if (less12()) {
+							++it1_;
+						} else if (less21()) {
+							++it2_;
+						} else {
+							break;
+						}
+					}
+					from_ = __from::both;
+				} else if constexpr (Op == __set_op::set_difference) {
+					while (it1_ != last1 && it2_ != last2 && !less12()) {
+						if (!less21()) {
+							++it1_;
+						}
+						++it2_;
+					}
+					from_ = __from::first;
+				} else {
+					while (true) {
+						if (it1_ == last1) {
+							from_ = __from::second;
+							break;
+						}
+						if (it2_ == last2 || less12()) {
+							from_ = __from::first;
+							break;
+						}
+						if (less21()) {
+							from_ = __from::second;
+							break;
+						}
+						++it1_;
+						++it2_;
+					}
+				}
+			}
+
+		public:
+			using iterator_category = meta::if_c<
+				ForwardRange<V1> && ForwardRange<V2>,
+				__stl2::forward_iterator_tag,
+				__stl2::input_iterator_tag>;
+			using value_type = typename types::value_type;
+			using difference_type = common_type_t<iter_difference_t<I1>,
+				iter_difference_t<I2>>;
+
+			__iterator() = default;
+
+			constexpr __iterator(set_algorithm_view& parent, I1 it1, I2 it2)
+			: parent_(&parent), it1_(std::move(it1)), it2_(std::move(it2))
+			{ satisfy(); }
+
+			constexpr I1 base1() const { return it1_; }
+			constexpr I2 base2() const { return it2_; }
+
+			constexpr typename types::reference operator*() const {
+				if constexpr (__set_op_reads_second<Op>) {
+					if (reads_second()) {
+						return *it2_;
+					}
+				}
+				return *it1_;
+			}
+
+			constexpr __iterator& operator++() {
+				if (from_ != __from::second) {
+					++it1_;
+				}
+				if (from_ != __from::first) {
+					++it2_;
+				}
+				satisfy();
+				return *this;
+			}
+
+			constexpr void operator++(int)
+			{ (void)++*this; }
+
+			constexpr __iterator operator++(int)
+			requires ForwardRange<V1> && ForwardRange<V2>
+			{
+				auto tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+			requires EqualityComparable<I1> && EqualityComparable<I2>
+			{ return x.it1_ == y.it1_ && x.it2_ == y.it2_; }
+
+			friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+			requires EqualityComparable<I1> && EqualityComparable<I2>
+			{ return !(x == y); }
+
+			friend constexpr typename types::rvalue_reference
+			iter_move(const __iterator& i)
+			{
+				if constexpr (__set_op_reads_second<Op>) {
+					if (i.reads_second()) {
+						return __stl2::iter_move(i.it2_);
+					}
+				}
+				return __stl2::iter_move(i.it1_);
+			}
+		};
+
+		template<__set_op Op, View V1, View V2, class Comp, class Proj1, class Proj2>
+		requires InputRange<V1> && InputRange<V2> &&
+			std::is_object_v<Comp> && std::is_object_v<Proj1> &&
+			std::is_object_v<Proj2> &&
+			IndirectStrictWeakOrder<Comp, projected<iterator_t<V1>, Proj1>,
+				projected<iterator_t<V2>, Proj2>> &&
+			__set_view_readable<Op, iterator_t<V1>, iterator_t<V2>>
+		class set_algorithm_view<Op, V1, V2, Comp, Proj1, Proj2>::__sentinel {
+		private:
+			sentinel_t<V1> last1_;
+			sentinel_t<V2> last2_;
+
+			// Whether the operation yields no elements past i.
+			constexpr bool done(const __iterator& i) const {
+				if constexpr (Op == __set_op::set_intersection) {
+					return i.it1_ == last1_ || i.it2_ == last2_;
+				} else if constexpr (Op == __set_op::set_difference) {
+					return i.it1_ == last1_;
+				} else {
+					return i.it1_ == last1_ && i.it2_ == last2_;
+				}
+			}
+
+		public:
+			__sentinel() = default;
+			explicit constexpr __sentinel(set_algorithm_view& parent)
+			: last1_(__stl2::end(parent.base1_)), last2_(__stl2::end(parent.base2_)) {}
+
+			friend constexpr bool operator==(const __iterator& x, const __sentinel& y)
+			{ return y.done(x); }
+			friend constexpr bool operator==(const __sentinel& x, const __iterator& y)
+			{ return x.done(y); }
+			friend constexpr bool operator!=(const __iterator& x, const __sentinel& y)
+			{ return !y.done(x); }
+			friend constexpr bool operator!=(const __sentinel& x, const __iterator& y)
+			{ return !x.done(y); }
+		};
+
+		template<View V1, View V2, class Comp = less, class Proj1 = identity,
+			class Proj2 = identity>
+		using merge_view =
+			set_algorithm_view<__set_op::merge, V1, V2, Comp, Proj1, Proj2>;
+		template<View V1, View V2, class Comp = less, class Proj1 = identity,
+			class Proj2 = identity>
+		using set_union_view =
+			set_algorithm_view<__set_op::set_union, V1, V2, Comp, Proj1, Proj2>;
+		template<View V1, View V2, class Comp = less, class Proj1 = identity,
+			class Proj2 = identity>
+		using set_intersection_view =
+			set_algorithm_view<__set_op::set_intersection, V1, V2, Comp, Proj1, Proj2>;
+		template<View V1, View V2, class Comp = less, class Proj1 = identity,
+			class Proj2 = identity>
+		using set_difference_view =
+			set_algorithm_view<__set_op::set_difference, V1, V2, Comp, Proj1, Proj2>;
+		template<View V1, View V2, class Comp = less, class Proj1 = identity,
+			class Proj2 = identity>
+		using set_symmetric_difference_view =
+			set_algorithm_view<__set_op::set_symmetric_difference, V1, V2, Comp,
+				Proj1, Proj2>;
+	} // namespace ext
+
+	namespace view::ext {
+		template<__stl2::ext::__set_op Op>
+		struct __set_algorithm_fn {
+			template<InputRange R1, InputRange R2, class Comp = less,
+				class Proj1 = identity, class Proj2 = identity>
+			requires ViewableRange<R1> && ViewableRange<R2>
+			constexpr auto operator()(R1&& r1, R2&& r2, Comp comp = {},
+				Proj1 proj1 = {}, Proj2 proj2 = {}) const
+			STL2_REQUIRES_RETURN(
+				__stl2::ext::set_algorithm_view<Op, all_view<R1>, all_view<R2>,
+					Comp, Proj1, Proj2>{
+					view::all(std::forward<R1>(r1)), view::all(std::forward<R2>(r2)),
+					std::move(comp), std::move(proj1), std::move(proj2)}
+			)
+
+			// a | view::ext::set_intersection(b) is
+			// view::ext::set_intersection(a, b).
+			template<InputRange R2, CopyConstructible Comp = less,
+				CopyConstructible Proj1 = identity, CopyConstructible Proj2 = identity>
+			requires ViewableRange<R2> && !Range<Comp>
+			constexpr auto operator()(R2&& r2, Comp comp = {}, Proj1 proj1 = {},
+				Proj2 proj2 = {}) const
+			{
+				return detail::view_closure{*this, view::all(std::forward<R2>(r2)),
+					std::move(comp), std::move(proj1), std::move(proj2)};
+			}
+		};
+
+		inline constexpr __set_algorithm_fn<__stl2::ext::__set_op::merge> merge {};
+		inline constexpr __set_algorithm_fn<__stl2::ext::__set_op::set_union>
+			set_union {};
+		inline constexpr __set_algorithm_fn<__stl2::ext::__set_op::set_intersection>
+			set_intersection {};
+		inline constexpr __set_algorithm_fn<__stl2::ext::__set_op::set_difference>
+			set_difference {};
+		inline constexpr
+			__set_algorithm_fn<__stl2::ext::__set_op::set_symmetric_difference>
+			set_symmetric_difference {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
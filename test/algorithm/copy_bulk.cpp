@@ -0,0 +1,229 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/copy_backward.hpp>
+#include <stl2/detail/algorithm/copy_n.hpp>
+#include <stl2/detail/algorithm/move.hpp>
+#include <stl2/detail/algorithm/move_backward.hpp>
+#include <stl2/iterator.hpp>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../bulk_test.hpp"
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct trivial {
+		int i;
+		char c;
+		bool operator==(const trivial& that) const {
+			return i == that.i && c == that.c;
+		}
+	};
+
+	using bulk_test::iota;
+
+	// The copy family memmoves contiguous ints: each result iterator
+	// lands one past the last element written, and nothing outside the
+	// destination changes.
+	void test_sizes() {
+		for (int n : bulk_test::sizes) {
+			const auto src = iota(n, 1);
+			std::vector<int> dst(n + 2);
+
+			auto r = ranges::copy(src, dst.begin() + 1);
+			CHECK(r.in == src.end());
+			CHECK((r.out - dst.begin()) == n + 1);
+			CHECK(std::equal(src.begin(), src.end(), dst.begin() + 1));
+			CHECK(dst.front() == 0);
+			CHECK(dst.back() == 0);
+
+			std::fill(dst.begin(), dst.end(), 0);
+			auto rn = ranges::copy_n(src.data(), n, dst.data());
+			CHECK(rn.in == src.data() + n);
+			CHECK(rn.out == dst.data() + n);
+			CHECK(std::equal(src.begin(), src.end(), dst.begin()));
+
+			std::fill(dst.begin(), dst.end(), 0);
+			auto rb = ranges::copy_backward(src, dst.end() - 1);
+			CHECK(rb.in == src.end());
+			CHECK((rb.out - dst.begin()) == 1);
+			CHECK(std::equal(src.begin(), src.end(), dst.begin() + 1));
+			CHECK(dst.back() == 0);
+
+			std::fill(dst.begin(), dst.end(), 0);
+			auto rm = ranges::move(src.begin(), src.end(), dst.data());
+			CHECK(rm.in == src.end());
+			CHECK(rm.out == dst.data() + n);
+			CHECK(std::equal(src.begin(), src.end(), dst.begin()));
+
+			std::fill(dst.begin(), dst.end(), 0);
+			auto rmb = ranges::move_backward(src.data(), src.data() + n, dst.data() + n);
+			CHECK(rmb.in == src.data() + n);
+			CHECK(rmb.out == dst.data());
+			CHECK(std::equal(src.begin(), src.end(), dst.begin()));
+
+			// The extension stops at the end of the shorter range.
+			std::vector<int> half(n / 2);
+			auto re = ranges::ext::copy(src, half);
+			CHECK((re.in - src.begin()) == n / 2);
+			CHECK(re.out == half.end());
+			CHECK(std::equal(half.begin(), half.end(), src.begin()));
+			std::fill(dst.begin(), dst.end(), 0);
+			auto rme = ranges::ext::move(half, dst);
+			CHECK(rme.in == half.end());
+			CHECK((rme.out - dst.begin()) == n / 2);
+			CHECK(std::equal(half.begin(), half.end(), dst.begin()));
+		}
+	}
+
+	void test_adaptors() {
+		const auto src = iota(100, 1);
+		std::vector<int> dst(100);
+
+		// move_iterator, of both libraries
+		{
+			auto r = ranges::copy(ranges::make_move_iterator(src.begin()),
+				ranges::make_move_iterator(src.end()), dst.begin());
+			CHECK(r.in.base() == src.end());
+			CHECK(r.out == dst.end());
+			CHECK(dst == src);
+			std::fill(dst.begin(), dst.end(), 0);
+			auto r2 = ranges::move(std::make_move_iterator(src.begin()),
+				std::make_move_iterator(src.end()), dst.begin());
+			CHECK(r2.in.base() == src.end());
+			CHECK(dst == src);
+		}
+
+		// counted_iterator, in and out
+		{
+			std::fill(dst.begin(), dst.end(), 0);
+			auto r = ranges::copy(ranges::counted_iterator{src.begin(), 60},
+				ranges::default_sentinel{}, ranges::counted_iterator{dst.begin() + 10, 90});
+			CHECK(r.in.count() == 0);
+			CHECK(r.in.base() == src.begin() + 60);
+			CHECK(r.out.count() == 30);
+			CHECK(r.out.base() == dst.begin() + 70);
+			CHECK(std::equal(src.begin(), src.begin() + 60, dst.begin() + 10));
+			CHECK(dst[9] == 0);
+			CHECK(dst[70] == 0);
+			auto rn = ranges::copy_n(ranges::counted_iterator{src.begin() + 50, 50}, 40, dst.begin());
+			CHECK(rn.in.count() == 10);
+			CHECK(rn.in.base() == src.begin() + 90);
+			CHECK(std::equal(src.begin() + 50, src.begin() + 90, dst.begin()));
+		}
+
+		// Pairs of reverse_iterators, of both libraries
+		{
+			std::fill(dst.begin(), dst.end(), 0);
+			auto r = ranges::copy(src.rbegin(), src.rbegin() + 30, dst.rbegin() + 5);
+			CHECK(r.in == src.rbegin() + 30);
+			CHECK(r.out == dst.rbegin() + 35);
+			CHECK(std::equal(src.end() - 30, src.end(), dst.end() - 35));
+			CHECK(dst[64] == 0);
+			CHECK(dst[95] == 0);
+
+			std::fill(dst.begin(), dst.end(), 0);
+			using R = ranges::reverse_iterator<const int*>;
+			using W = ranges::reverse_iterator<int*>;
+			auto r2 = ranges::copy(R{src.data() + 100}, R{src.data()}, W{dst.data() + 100});
+			CHECK(r2.in.base() == src.data());
+			CHECK(r2.out.base() == dst.data());
+			CHECK(dst == src);
+
+			std::fill(dst.begin(), dst.end(), 0);
+			auto r3 = ranges::copy_backward(R{src.data() + 100}, R{src.data() + 50},
+				W{dst.data()});
+			CHECK(r3.in.base() == src.data() + 50);
+			CHECK(r3.out.base() == dst.data() + 50);
+			CHECK(std::equal(src.begin() + 50, src.end(), dst.begin()));
+			CHECK(dst[50] == 0);
+		}
+
+		// One reverse_iterator reverses the elements.
+		{
+			auto r = ranges::copy(src.rbegin(), src.rend(), dst.begin());
+			CHECK(r.out == dst.end());
+			CHECK(std::equal(src.rbegin(), src.rend(), dst.begin()));
+			ranges::copy(src.begin(), src.end(), dst.rbegin());
+			CHECK(std::equal(src.rbegin(), src.rend(), dst.begin()));
+		}
+	}
+
+	// Overlapping ranges, as copy and copy_backward allow them
+	void test_overlap() {
+		auto v = iota(100);
+		auto r = ranges::copy(v.begin() + 10, v.end(), v.begin());
+		CHECK((r.out - v.begin()) == 90);
+		CHECK(std::equal(v.begin(), v.begin() + 90, iota(90, 10).begin()));
+
+		v = iota(100);
+		auto rb = ranges::copy_backward(v.begin(), v.begin() + 90, v.end());
+		CHECK((rb.out - v.begin()) == 10);
+		CHECK(std::equal(v.begin() + 10, v.end(), iota(90).begin()));
+
+		v = iota(100);
+		ranges::move_backward(v.rbegin(), v.rbegin() + 90, v.rend());
+		CHECK(std::equal(v.begin(), v.begin() + 90, iota(90, 10).begin()));
+	}
+}
+
+int main() {
+	test_sizes();
+	test_adaptors();
+	test_overlap();
+
+	// Trivially copyable classes
+	{
+		std::vector<trivial> src(50), dst(50);
+		for (int i = 0; i < 50; ++i) src[i] = {i, static_cast<char>('a' + i % 26)};
+		ranges::copy(src, dst.begin());
+		CHECK(dst == src);
+	}
+
+	// Elements of other types, and that aren't trivially copyable, are
+	// assigned one at a time.
+	{
+		const auto src = iota(50, -25);
+		std::vector<long> dst(50);
+		ranges::copy(src, dst.begin());
+		CHECK(std::equal(src.begin(), src.end(), dst.begin()));
+		std::vector<std::string> s(10, "a long string that is allocated"), t(10);
+		ranges::copy(s, t.begin());
+		CHECK(t == s);
+		ranges::move(s, t.begin());
+		CHECK(t[9] == "a long string that is allocated");
+		CHECK(s[9].empty());
+		std::vector<std::unique_ptr<int>> u(10), w(10);
+		for (auto& p : u) p = std::make_unique<int>(42);
+		ranges::move_backward(u, w.end());
+		CHECK(*w[0] == 42);
+		CHECK(!u[0]);
+	}
+
+	// Constant evaluation
+	{
+		constexpr auto f = [] {
+			int a[] = {1, 2, 3, 4, 5};
+			int b[5] = {};
+			ranges::copy(a, b);
+			ranges::copy_backward(a, a + 2, a + 5);
+			ranges::move(b + 2, b + 5, b);
+			return a[3] * 10 + b[0];
+		};
+		static_assert(f() == 13);
+	}
+
+	return ::test_result();
+}
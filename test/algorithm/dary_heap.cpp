@@ -0,0 +1,160 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/dary_heap.hpp>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	// The offset of the first element greater than its parent.
+	template<std::ptrdiff_t Arity>
+	std::ptrdiff_t reference_is_heap_until(const std::vector<int>& v) {
+		for (std::ptrdiff_t i = 1; i < std::ptrdiff_t(v.size()); ++i) {
+			if (v[(i - 1) / Arity] < v[i]) {
+				return i;
+			}
+		}
+		return std::ptrdiff_t(v.size());
+	}
+
+	template<std::ptrdiff_t Arity>
+	void test(int n) {
+		std::vector<int> v(n);
+		for (auto& x : v) x = static_cast<int>(gen() % (n / 2 + 1));
+		auto sorted = v;
+		std::sort(sorted.begin(), sorted.end());
+
+		// make_heap, is_heap, is_heap_until
+		auto h = v;
+		CHECK(ranges::ext::make_heap<Arity>(h) == h.end());
+		CHECK(ranges::ext::is_heap<Arity>(h));
+		CHECK(ranges::ext::is_heap_until<Arity>(h.begin(), h.end()) == h.end());
+		CHECK(reference_is_heap_until<Arity>(h) == n);
+		CHECK(std::is_permutation(h.begin(), h.end(), v.begin()));
+		if (n > 1) {
+			auto broken = h;
+			broken.back() = sorted.back() + 1;
+			CHECK(!ranges::ext::is_heap<Arity>(broken));
+			const auto until = ranges::ext::is_heap_until<Arity>(broken);
+			CHECK(reference_is_heap_until<Arity>(broken) == until - broken.begin());
+		}
+
+		// push_heap one element at a time
+		h.clear();
+		for (int i = 0; i < n; ++i) {
+			h.push_back(v[i]);
+			CHECK(ranges::ext::push_heap<Arity>(h.begin(), h.end()) == h.end());
+			CHECK(reference_is_heap_until<Arity>(h) == i + 1);
+		}
+
+		// pop_heap yields the elements in decreasing order
+		for (int i = n; i > 0; --i) {
+			CHECK(ranges::ext::pop_heap<Arity>(h.begin(), h.begin() + i) == h.begin() + i);
+			CHECK(h[i - 1] == sorted[i - 1]);
+			CHECK(ranges::ext::is_heap<Arity>(h.begin(), h.begin() + (i - 1)));
+		}
+		CHECK(h == sorted);
+
+		// sort_heap
+		h = v;
+		ranges::ext::make_heap<Arity>(h);
+		CHECK(ranges::ext::sort_heap<Arity>(h) == h.end());
+		CHECK(h == sorted);
+
+		// A min-heap, through a projection and random access iterators
+		h = v;
+		auto neg = [](int x) { return -x; };
+		using I = random_access_iterator<int*>;
+		ranges::ext::make_heap<Arity>(I{h.data()}, I{h.data() + n}, ranges::less{}, neg);
+		CHECK(ranges::ext::is_heap<Arity>(h, ranges::greater{}));
+		CHECK(ranges::ext::sort_heap<Arity>(I{h.data()}, I{h.data() + n},
+			ranges::less{}, neg) == I{h.data() + n});
+		CHECK(std::is_sorted(h.begin(), h.end(), std::greater<>{}));
+	}
+
+	// A mix of pushes and pops, as a priority queue.
+	template<std::ptrdiff_t Arity>
+	void test_priority_queue() {
+		std::vector<int> h, reference;
+		for (int i = 0; i < 20000; ++i) {
+			if (h.empty() || gen() % 3 != 0) {
+				const int x = static_cast<int>(gen() % 1000);
+				h.push_back(x);
+				ranges::ext::push_heap<Arity>(h);
+				reference.push_back(x);
+				std::push_heap(reference.begin(), reference.end());
+			} else {
+				ranges::ext::pop_heap<Arity>(h);
+				std::pop_heap(reference.begin(), reference.end());
+				CHECK(h.back() == reference.back());
+				h.pop_back();
+				reference.pop_back();
+			}
+		}
+		CHECK(ranges::ext::is_heap<Arity>(h));
+	}
+
+	template<std::ptrdiff_t Arity>
+	void test_all() {
+		constexpr int a = Arity;
+		for (int n : {0, 1, 2, 3, a, a + 1, a * a + 2, 100, 1000}) {
+			test<Arity>(n);
+		}
+		test_priority_queue<Arity>();
+	}
+
+	struct S {
+		int key;
+		std::unique_ptr<int> payload;
+	};
+}
+
+int main() {
+	test_all<2>();
+	test_all<3>();
+	test_all<4>();
+	test_all<8>();
+
+	// The binary heap is the standard layout.
+	{
+		std::vector<int> v(1000);
+		for (auto& x : v) x = static_cast<int>(gen() % 100);
+		ranges::ext::make_heap<2>(v);
+		CHECK(std::is_heap(v.begin(), v.end()));
+		std::make_heap(v.begin(), v.end(), std::greater<>{});
+		CHECK(ranges::ext::is_heap<2>(v, ranges::greater{}));
+	}
+
+	// Move-only elements
+	{
+		std::vector<S> v;
+		for (int i = 0; i < 500; ++i) {
+			v.push_back(S{(i * 131) % 500, std::make_unique<int>(i)});
+		}
+		ranges::ext::make_heap<4>(v, ranges::less{}, &S::key);
+		CHECK(ranges::ext::is_heap<4>(v, ranges::less{}, &S::key));
+		ranges::ext::sort_heap<4>(v, ranges::less{}, &S::key);
+		for (int i = 0; i < 500; ++i) {
+			CHECK(v[i].key == i);
+			CHECK(v[i].payload != nullptr);
+			CHECK(i == *v[i].payload * 131 % 500);
+		}
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,136 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/fill.hpp>
+#include <stl2/detail/algorithm/fill_n.hpp>
+#include <stl2/iterator.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <string>
+#include <vector>
+#include "../bulk_test.hpp"
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	using bulk_test::bytes;
+	using bulk_test::make;
+
+	// fill stores values whose bytes differ a vector at a time, and
+	// memsets those whose bytes are all the same. Either way, whatever the
+	// alignment of the first element, every element gets the value and
+	// the guards on either side keep theirs.
+	template<class T>
+	void test(const T& value) {
+		for (int n : bulk_test::sizes) {
+			for (int offset = 1; offset < 4; ++offset) {
+				const T guard = make<T>(-1);
+				std::vector<T> v(n + offset + 1, guard);
+				CHECK(ranges::fill(v.data() + offset, v.data() + offset + n, value) ==
+					v.data() + offset + n);
+				CHECK(std::count(v.begin() + offset, v.end() - 1, value) == n);
+				CHECK(v[offset - 1] == guard);
+				CHECK(v.back() == guard);
+
+				std::fill(v.begin(), v.end(), guard);
+				CHECK(ranges::fill_n(v.begin() + offset, n, value) == v.begin() + offset + n);
+				CHECK(std::count(v.begin() + offset, v.end() - 1, value) == n);
+				CHECK(v[offset - 1] == guard);
+				CHECK(v.back() == guard);
+			}
+		}
+	}
+
+	template<class T>
+	void test() {
+		test(make<T>(5));
+		test(T{});
+		T same;
+		std::memset(&same, 0x41, sizeof(T));
+		test(same);
+	}
+}
+
+int main() {
+	test<unsigned char>();
+	test<signed char>();
+	test<std::uint16_t>();
+	test<int>();
+	test<std::int64_t>();
+	test<float>();
+	test<double>();
+	test<bytes<3>>();
+	test<bytes<8>>();
+	test<bytes<16>>();
+	test<bytes<24>>();
+	test<bytes<128>>();
+
+	// Zeroes of either sign
+	{
+		std::vector<double> v(100, 1.0);
+		ranges::fill(v, -0.0);
+		CHECK(std::all_of(v.begin(), v.end(), [](double d) { return d == 0.0 && std::signbit(d); }));
+	}
+
+	// Values converted to the elements' type
+	{
+		std::vector<char> v(100);
+		ranges::fill(v, 'a' + 256);
+		CHECK(std::count(v.begin(), v.end(), 'a') == 100);
+		std::vector<int> w(100);
+		ranges::fill_n(w.rbegin(), 50, 2.5);
+		CHECK(std::count(w.begin() + 50, w.end(), 2) == 50);
+		CHECK(std::count(w.begin(), w.begin() + 50, 0) == 50);
+	}
+
+	// Counts that aren't positive fill nothing and return first.
+	{
+		std::vector<int> v(10, 1);
+		CHECK(ranges::fill_n(v.data() + 5, -3, 2) == v.data() + 5);
+		CHECK(ranges::fill_n(v.begin() + 5, 0, 2) == v.begin() + 5);
+		CHECK(ranges::fill_n(v.rbegin(), -1, 2) == v.rbegin());
+		CHECK(std::count(v.begin(), v.end(), 1) == 10);
+	}
+
+	// Through counted_iterators
+	{
+		std::vector<int> v(100);
+		auto r = ranges::fill(ranges::counted_iterator{v.begin(), 60}, ranges::default_sentinel{}, 7);
+		CHECK(r.count() == 0);
+		CHECK(r.base() == v.begin() + 60);
+		CHECK(std::count(v.begin(), v.end(), 7) == 60);
+	}
+
+	// Other ranges are filled one element at a time.
+	{
+		std::list<int> l(100);
+		ranges::fill(l, 3);
+		CHECK(std::count(l.begin(), l.end(), 3) == 100);
+		std::vector<std::string> s(10);
+		ranges::fill(s, std::string("a long string that is allocated"));
+		CHECK(s[9] == "a long string that is allocated");
+	}
+
+	// Constant evaluation
+	{
+		constexpr auto f = [] {
+			int a[5] = {};
+			ranges::fill(a, 3);
+			ranges::fill_n(a, 2, 1);
+			return a[0] + a[4];
+		};
+		static_assert(f() == 4);
+	}
+
+	return ::test_result();
+}
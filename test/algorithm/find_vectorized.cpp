@@ -0,0 +1,204 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/all_of.hpp>
+#include <stl2/detail/algorithm/any_of.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/count_if.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/algorithm/find_if.hpp>
+#include <stl2/detail/algorithm/find_if_not.hpp>
+#include <stl2/detail/algorithm/none_of.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "../bulk_test.hpp"
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	// find and count search contiguous numbers a vector at a time; through
+	// input iterators, they read one element at a time, and must agree.
+	template<class T>
+	void test(const std::vector<T>& v, const T value) {
+		using I = input_iterator<const T*>;
+		const auto first = I{v.data()};
+		const auto last = sentinel<const T*>{v.data() + v.size()};
+		const auto n = static_cast<std::ptrdiff_t>(v.size());
+		const auto pos = ranges::find(first, last, value).base() - v.data();
+		const auto cnt = ranges::count(first, last, value);
+		const auto eq = [value](T x) { return x == value; };
+
+		CHECK((ranges::find(v, value) - v.begin()) == pos);
+		CHECK((ranges::find(v.data(), v.data() + n, value) - v.data()) == pos);
+		CHECK(ranges::count(v, value) == cnt);
+		CHECK((ranges::find_if(v, eq) - v.begin()) == pos);
+		CHECK(ranges::count_if(v, eq) == cnt);
+		CHECK(ranges::any_of(v, eq) == (pos != n));
+		CHECK(ranges::none_of(v, eq) == (pos == n));
+		CHECK(ranges::all_of(v, eq) == (cnt == n));
+
+		const auto ne = [value](T x) { return !(x == value); };
+		CHECK((ranges::find_if_not(v, ne) - v.begin()) == pos);
+	}
+
+	// Each position of the first match, and each size, about the sizes
+	// of the vectors and blocks.
+	template<class T>
+	void test_positions() {
+		for (int n : bulk_test::sizes) {
+			std::vector<T> v(n, T(1));
+			test(v, T(2));
+			test(v, T(1));
+			for (int i = 0; i < n; ++i) {
+				v[i] = T(2);
+				test(v, T(2));
+				if (i % 3 == 0) {
+					v[n - 1 - i / 3] = T(2);
+					test(v, T(2));
+					v[n - 1 - i / 3] = T(1);
+				}
+				v[i] = T(1);
+			}
+		}
+	}
+}
+
+int main() {
+	test_positions<signed char>();
+	test_positions<unsigned char>();
+	test_positions<char>();
+	test_positions<std::int16_t>();
+	test_positions<std::uint16_t>();
+	test_positions<int>();
+	test_positions<unsigned>();
+	test_positions<std::int64_t>();
+	test_positions<std::uint64_t>();
+	test_positions<float>();
+	test_positions<double>();
+
+	// Values that the element type cannot hold equal no element.
+	{
+		std::vector<signed char> v(100, -56);
+		CHECK(ranges::find(v, 200) == v.end());
+		CHECK(ranges::count(v, 200) == 0);
+		CHECK(ranges::find(v, -56) == v.begin());
+		CHECK(ranges::find(v, 456) == v.end());
+	}
+	{
+		std::vector<unsigned char> v(100, 200);
+		CHECK(ranges::find(v, -56) == v.end());
+		CHECK(ranges::count(v, 200) == 100);
+		CHECK(ranges::count(v, 200L) == 100);
+	}
+	{
+		// Comparisons of unsigned with negative values convert both to
+		// unsigned.
+		std::vector<unsigned> v(100, std::numeric_limits<unsigned>::max());
+		CHECK(ranges::count(v, -1) == 100);
+		std::vector<std::uint16_t> w(100, std::numeric_limits<std::uint16_t>::max());
+		CHECK(ranges::count(w, -1) == 0);
+	}
+
+	// More matches than the lanes of a running sum can count
+	{
+		std::vector<char> v(100000, 'x');
+		v[5000] = 'y';
+		CHECK(ranges::count(v, 'x') == 99999);
+		CHECK(ranges::count_if(v, [](char c) { return c == 'x'; }) == 99999);
+		CHECK((ranges::find(v, 'y') - v.begin()) == 5000);
+	}
+
+	// Zeroes equal each other.
+	{
+		std::vector<double> v(50, 1.0);
+		v[40] = -0.0;
+		CHECK(ranges::count(v, 0.0) == 1);
+		CHECK((ranges::find(v, 0.0) - v.begin()) == 40);
+	}
+
+#if !defined(__FAST_MATH__)
+	// Not-a-number equals nothing. (-ffast-math assumes there is none.)
+	{
+		std::vector<double> v(50, std::nan(""));
+		v[40] = 0.0;
+		CHECK(ranges::find(v, std::nan("")) == v.end());
+		CHECK(ranges::count(v, 0.0) == 1);
+		std::vector<float> w(50, std::nanf(""));
+		CHECK(ranges::count_if(w, [](float x) { return x != x; }) == 50);
+	}
+#endif
+
+	// Predicates that take the elements by mutable reference, and stateful
+	// predicates
+	{
+		std::vector<int> v(1000);
+		for (int i = 0; i < 1000; ++i) v[i] = i;
+		CHECK((ranges::find_if(v, [](int& x) { return x == 700; }) - v.begin()) == 700);
+		int calls = 0;
+		CHECK(ranges::count_if(v, [&calls](int x) { ++calls; return x % 2 == 0; }) == 500);
+		CHECK(calls == 1000);
+
+		// Searches stop at the first element that satisfies the
+		// predicate, whose precondition may not hold after it.
+		calls = 0;
+		const auto until_700 = [&calls](int x) {
+			++calls;
+			CHECK(x <= 700);
+			return x == 700;
+		};
+		CHECK((ranges::find_if(v, until_700) - v.begin()) == 700);
+		CHECK(calls == 701);
+		calls = 0;
+		CHECK(ranges::any_of(v, until_700));
+		CHECK(calls == 701);
+		calls = 0;
+		CHECK(!ranges::none_of(v, until_700));
+		CHECK(calls == 701);
+		calls = 0;
+		CHECK(!ranges::all_of(v, [&calls](int x) { ++calls; return x < 3; }));
+		CHECK(calls == 4);
+		calls = 0;
+		CHECK((ranges::find_if_not(v, [&calls](int x) { ++calls; return x < 3; }) - v.begin()) == 3);
+		CHECK(calls == 4);
+	}
+
+	// Volatile elements are read one at a time.
+	{
+		volatile int v[100] = {};
+		v[60] = 1;
+		CHECK((ranges::find(v, 1) - v) == 60);
+		CHECK(ranges::count(v, 0) == 99);
+	}
+
+	// Projections
+	{
+		std::vector<int> v(1000, 3);
+		v[500] = 4;
+		CHECK((ranges::find(v, 8, [](int x) { return 2 * x; }) - v.begin()) == 500);
+		CHECK(ranges::count(v, 6, [](int x) { return 2 * x; }) == 999);
+	}
+
+	// Constant evaluation
+	{
+		constexpr int a[] = {3, 1, 4, 1, 5, 9, 2, 6};
+		static_assert(ranges::find(a, 5) == a + 4);
+		static_assert(ranges::count(a, 1) == 2);
+		static_assert(ranges::find_if(a, [](int x) { return x > 4; }) == a + 4);
+		static_assert(ranges::count_if(a, [](int x) { return x > 4; }) == 3);
+		static_assert(ranges::any_of(a, [](int x) { return x == 9; }));
+		static_assert(ranges::all_of(a, [](int x) { return x > 0; }));
+		static_assert(ranges::none_of(a, [](int x) { return x > 9; }));
+	}
+
+	return ::test_result();
+}
@@ -20,6 +20,7 @@
 
 #include <stl2/detail/algorithm/includes.hpp>
 #include <functional>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -149,5 +150,23 @@ int main()
 		CHECK(stl2::includes(ia, id, std::less<int>(), &S::i, &T::j));
 	}
 
+	// A few elements of a much longer range, which includes gallops
+	// through
+	{
+		std::vector<int> big(200000);
+		for (int i = 0; i < 200000; ++i) big[i] = 2 * (i / 2);
+		std::vector<int> small{0, 0, 2, 4000, 4000, 150000, 199998};
+		CHECK(stl2::includes(big, small));
+		CHECK(stl2::includes(big, small, std::less<int>(), [](int x) { return x; }));
+		CHECK(!stl2::includes(big, std::vector<int>{0, 4000, 4000, 4000}));
+		small.push_back(199999);
+		CHECK(!stl2::includes(big, small));
+		small[3] = 4001;
+		CHECK(!stl2::includes(big, small));
+		std::vector<int> rbig(big.rbegin(), big.rend()), rsmall{199998, 150000, 0};
+		CHECK(stl2::includes(rbig, rsmall, std::greater<int>()));
+		CHECK(!stl2::includes(small, big));
+	}
+
 	return ::test_result();
 }
@@ -22,6 +22,7 @@
 #include <cassert>
 #include <algorithm>
 #include <random>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -127,8 +128,36 @@ test()
 	test<Iter>(1000);
 }
 
+// Merges of keys drawn from [0, range) preserve the order of equivalent
+// elements.
+void test_stability(unsigned N, unsigned M, int range)
+{
+	struct S {
+		int key;
+		int tag;
+	};
+	std::vector<S> v(N);
+	for (unsigned i = 0; i < N; ++i)
+		v[i] = {static_cast<int>(gen() % range), static_cast<int>(i)};
+	auto by_key = [](const S& x, const S& y) { return x.key < y.key; };
+	std::stable_sort(v.begin(), v.begin() + M, by_key);
+	std::stable_sort(v.begin() + M, v.end(), by_key);
+	stl2::inplace_merge(v, v.begin() + M, stl2::less{}, &S::key);
+	for (unsigned i = 1; i < N; ++i) {
+		CHECK(v[i - 1].key <= v[i].key);
+		if (v[i - 1].key == v[i].key)
+			CHECK(v[i - 1].tag < v[i].tag);
+	}
+}
+
 int main()
 {
+	for (int range : {2, 100, 1 << 30}) {
+		for (unsigned M : {0u, 1u, 10u, 500u, 990u, 1000u}) {
+			test_stability(1000, M, range);
+		}
+	}
+
 	// test<forward_iterator<int*> >();
 	test<bidirectional_iterator<int*> >();
 	test<random_access_iterator<int*> >();
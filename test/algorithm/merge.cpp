@@ -16,11 +16,47 @@
 #include <stl2/detail/algorithm/merge.hpp>
 #include <algorithm>
 #include <memory>
+#include <random>
 #include <utility>
+#include <vector>
 #include "../simple_test.hpp"
 
 namespace ranges = __stl2;
 
+namespace {
+	struct S {
+		int key;
+		int tag;
+	};
+
+	bool operator==(const S& a, const S& b) {
+		return a.key == b.key && a.tag == b.tag;
+	}
+
+	// Merges of keys drawn from [0, range) preserve the order of
+	// equivalent elements, as std::merge does.
+	void test_stability(std::mt19937& gen, int n1, int n2, int range) {
+		std::vector<S> a(n1), b(n2);
+		int tag = 0;
+		for (auto& x : a) x = {static_cast<int>(gen() % range), tag++};
+		for (auto& x : b) x = {static_cast<int>(gen() % range), tag++};
+		auto by_key = [](const S& x, const S& y) { return x.key < y.key; };
+		std::stable_sort(a.begin(), a.end(), by_key);
+		std::stable_sort(b.begin(), b.end(), by_key);
+		std::vector<S> expected(n1 + n2);
+		std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin(), by_key);
+
+		std::vector<S> out(n1 + n2);
+		auto r = ranges::merge(a, b, out.data(), ranges::less{}, &S::key, &S::key);
+		CHECK(r.out == out.data() + out.size());
+		CHECK(out == expected);
+
+		out.clear();
+		ranges::merge(a, b, ranges::back_inserter(out), ranges::less{}, &S::key, &S::key);
+		CHECK(out == expected);
+	}
+}
+
 int main() {
 	{
 		unsigned N = 100000;
@@ -82,5 +118,25 @@ int main() {
 		CHECK(std::is_sorted(ic.get(), ic.get() + 2 * N));
 	}
 
+	{
+		std::mt19937 gen;
+		for (int range : {2, 100, 1 << 30}) {
+			for (int n1 : {0, 1, 2, 3, 33, 64, 1000}) {
+				for (int n2 : {0, 1, 5, 32, 65, 999}) {
+					test_stability(gen, n1, n2, range);
+				}
+			}
+		}
+		// Long runs from each range in turn
+		std::vector<int> a, b, out(40000);
+		for (int i = 0; i < 20000; ++i) {
+			(i / 100 % 2 ? b : a).push_back(i);
+		}
+		ranges::merge(b, a, out.begin());
+		for (int i = 0; i < 20000; ++i) {
+			CHECK(out[i] == i);
+		}
+	}
+
 	return ::test_result();
 }
@@ -0,0 +1,139 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/merge_k.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/subrange.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct S {
+		int key;
+		int run;
+		int pos;
+	};
+
+	bool operator==(const S& a, const S& b) {
+		return a.key == b.key && a.run == b.run && a.pos == b.pos;
+	}
+
+	// A range whose elements are views, which exist only as they are read:
+	// [0, 5), [1, 6), ..., [9, 14).
+	struct overlapping_runs {
+		struct iterator {
+			using iterator_category = ranges::input_iterator_tag;
+			using value_type = ranges::iota_view<int, int>;
+			using difference_type = std::ptrdiff_t;
+
+			int i;
+
+			value_type operator*() const { return ranges::view::iota(i, i + 5); }
+			iterator& operator++() { ++i; return *this; }
+			iterator operator++(int) { auto tmp = *this; ++i; return tmp; }
+			bool operator==(const iterator& that) const { return i == that.i; }
+			bool operator!=(const iterator& that) const { return i != that.i; }
+		};
+
+		iterator begin() const { return {0}; }
+		iterator end() const { return {10}; }
+	};
+
+	// k sorted runs of random lengths up to max_length, with keys drawn from
+	// [0, range).
+	std::vector<std::vector<S>> runs(int k, int max_length, int range) {
+		std::vector<std::vector<S>> result(k);
+		for (int r = 0; r < k; ++r) {
+			result[r].resize(gen() % (max_length + 1));
+			for (auto& s : result[r]) s.key = static_cast<int>(gen() % range);
+			std::sort(result[r].begin(), result[r].end(),
+				[](const S& a, const S& b) { return a.key < b.key; });
+			for (int i = 0; i < (int)result[r].size(); ++i) {
+				result[r][i].run = r;
+				result[r][i].pos = i;
+			}
+		}
+		return result;
+	}
+
+	void test(int k, int max_length, int range) {
+		const auto input = runs(k, max_length, range);
+		// Equivalent elements are ordered by run, then position.
+		std::vector<S> expected;
+		for (auto& r : input) expected.insert(expected.end(), r.begin(), r.end());
+		std::stable_sort(expected.begin(), expected.end(),
+			[](const S& a, const S& b) { return a.key < b.key; });
+
+		std::vector<S> out(expected.size());
+		CHECK(ranges::ext::merge_k(input, out.begin(), ranges::less{}, &S::key) ==
+			out.end());
+		CHECK(out == expected);
+
+		// Descending, through a back_inserter
+		auto reversed = input;
+		for (auto& r : reversed) std::reverse(r.begin(), r.end());
+		out.clear();
+		ranges::ext::merge_k(reversed, ranges::back_inserter(out),
+			ranges::greater{}, &S::key);
+		CHECK(out.size() == expected.size());
+		CHECK(std::is_sorted(out.begin(), out.end(),
+			[](const S& a, const S& b) { return a.key > b.key; }));
+	}
+}
+
+int main() {
+	for (int k : {0, 1, 2, 3, 5, 8, 64, 100, 1024}) {
+		test(k, 50, 1000);
+		test(k, 50, 3);
+	}
+	test(7, 20000, 1 << 30);
+
+	// Some ranges empty
+	{
+		std::vector<std::vector<int>> v{{}, {1, 4}, {}, {}, {0, 2, 3}, {}};
+		std::vector<int> out(5);
+		CHECK(ranges::ext::merge_k(v, out.begin()) == out.end());
+		CHECK(out == std::vector<int>{0, 1, 2, 3, 4});
+
+		std::vector<std::vector<int>> none{{}, {}, {}};
+		CHECK(ranges::ext::merge_k(none, out.begin()) == out.begin());
+	}
+
+	// Ranges of input iterators
+	{
+		int a[] = {1, 5, 9}, b[] = {2, 3, 10, 11}, c[] = {0, 4};
+		using I = input_iterator<const int*>;
+		using R = ranges::subrange<I>;
+		std::vector<R> v{R{I{a}, I{a + 3}}, R{I{b}, I{b + 4}}, R{I{c}, I{c + 2}}};
+		int out[9];
+		CHECK(ranges::ext::merge_k(v, out) == out + 9);
+		CHECK(std::is_sorted(out, out + 9));
+		CHECK(out[0] == 0);
+		CHECK(out[8] == 11);
+	}
+
+	// Ranges of prvalue views
+	{
+		std::vector<int> out;
+		ranges::ext::merge_k(overlapping_runs{}, ranges::back_inserter(out));
+		CHECK(out.size() == 50u);
+		CHECK(std::is_sorted(out.begin(), out.end()));
+		CHECK(out.front() == 0);
+		CHECK(out.back() == 13);
+	}
+
+	return ::test_result();
+}
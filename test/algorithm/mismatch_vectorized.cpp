@@ -0,0 +1,166 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/lexicographical_compare.hpp>
+#include <stl2/detail/algorithm/mismatch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "../bulk_test.hpp"
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	// Over contiguous numbers, equal and mismatch compare a vector at a
+	// time and lexicographical_compare uses memcmp for bytes; the answers
+	// are checked against the same calls through input iterators.
+	template<class T>
+	void test(const std::vector<T>& a, const std::vector<T>& b) {
+		using I = input_iterator<const T*>;
+		using S = sentinel<const T*>;
+		const auto ia = I{a.data()}, ib = I{b.data()};
+		const auto sa = S{a.data() + a.size()}, sb = S{b.data() + b.size()};
+		const auto [m1, m2] = ranges::mismatch(ia, sa, ib, sb);
+		const auto pos = m1.base() - a.data();
+		CHECK((m2.base() - b.data()) == pos);
+		const bool eq = ranges::equal(ia, sa, ib, sb);
+		const bool lt = ranges::lexicographical_compare(ia, sa, ib, sb);
+		CHECK(lt == std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+
+		const auto [v1, v2] = ranges::mismatch(a, b);
+		CHECK((v1 - a.begin()) == pos);
+		CHECK((v2 - b.begin()) == pos);
+		CHECK((ranges::mismatch(a.data(), a.data() + a.size(),
+			b.data(), b.data() + b.size()).in2 - b.data()) == pos);
+		CHECK(ranges::equal(a, b) == eq);
+		CHECK(ranges::equal(a.data(), a.data() + a.size(),
+			b.data(), b.data() + b.size()) == eq);
+		CHECK(ranges::lexicographical_compare(a, b) == lt);
+		CHECK(ranges::lexicographical_compare(a.data(), a.data() + a.size(),
+			b.data(), b.data() + b.size()) == lt);
+	}
+
+	// Each position of the first difference, either way, and each size,
+	// about the sizes of the vectors.
+	template<class T>
+	void test_positions() {
+		for (int n : bulk_test::sizes) {
+			std::vector<T> a(n);
+			for (int i = 0; i < n; ++i) a[i] = static_cast<T>(i % 7 + 1);
+			auto b = a;
+			test(a, b);
+			for (int i = 0; i < n; ++i) {
+				b[i] = static_cast<T>(a[i] + 1);
+				test(a, b);
+				test(b, a);
+				if (i % 5 == 0) {
+					// A later difference the other way
+					b[n - 1] = static_cast<T>(a[n - 1] - 1);
+					test(a, b);
+					test(b, a);
+					b[n - 1] = a[n - 1];
+				}
+				b[i] = a[i];
+			}
+			// Prefixes
+			for (int k : {0, 1, n / 2, n - 1}) {
+				if (k >= 0 && k <= n) {
+					std::vector<T> p(a.begin(), a.begin() + k);
+					test(a, p);
+					test(p, a);
+				}
+			}
+		}
+	}
+}
+
+int main() {
+	test_positions<signed char>();
+	test_positions<unsigned char>();
+	test_positions<char>();
+	test_positions<std::int16_t>();
+	test_positions<std::uint16_t>();
+	test_positions<int>();
+	test_positions<unsigned>();
+	test_positions<std::int64_t>();
+	test_positions<std::uint64_t>();
+	test_positions<float>();
+	test_positions<double>();
+
+	// Bytes order as unsigned char does, and signed bytes by their sign.
+	{
+		std::vector<unsigned char> a{1, 200, 3}, b{1, 100, 3};
+		CHECK(!ranges::lexicographical_compare(a, b));
+		CHECK(ranges::lexicographical_compare(b, a));
+		std::vector<signed char> c{1, -56, 3}, d{1, 100, 3};
+		CHECK(ranges::lexicographical_compare(c, d));
+		CHECK(!ranges::lexicographical_compare(d, c));
+		test(c, d);
+	}
+
+	// Zeroes equal each other.
+	{
+		std::vector<double> a(100, 1.0), b(100, 1.0);
+		a[30] = 0.0;
+		b[30] = -0.0;
+		CHECK(ranges::equal(a, b));
+		CHECK(ranges::mismatch(a, b).in1 == a.end());
+		CHECK(!ranges::lexicographical_compare(a, b));
+		CHECK(!ranges::lexicographical_compare(b, a));
+		test(a, b);
+	}
+
+#if !defined(__FAST_MATH__)
+	// Not-a-number equals nothing and is ordered with nothing. (-ffast-math
+	// assumes there is none.)
+	{
+		std::vector<double> a(100, 1.0), b(100, 1.0);
+		a[60] = std::nan("");
+		b[60] = std::nan("");
+		CHECK(!ranges::equal(a, b));
+		CHECK((ranges::mismatch(a, b).in1 - a.begin()) == 60);
+		b[80] = 2.0;
+		CHECK(ranges::lexicographical_compare(a, b));
+		CHECK(!ranges::lexicographical_compare(b, a));
+		test(a, b);
+		b[80] = 1.0;
+		b.push_back(1.0);
+		CHECK(ranges::lexicographical_compare(a, b));
+		CHECK(!ranges::lexicographical_compare(b, a));
+		std::vector<float> f(50, std::nanf(""));
+		CHECK(!ranges::equal(f, f));
+		CHECK(!ranges::lexicographical_compare(f, f));
+	}
+#endif
+
+	// Predicates and projections compare element by element.
+	{
+		std::vector<int> a(100, 3), b(100, -3);
+		const auto abs = [](int x) { return x < 0 ? -x : x; };
+		CHECK(ranges::equal(a, b, ranges::equal_to{}, abs, abs));
+		CHECK(ranges::mismatch(a, b, ranges::equal_to{}, abs, abs).in1 == a.end());
+		CHECK(!ranges::lexicographical_compare(b, a, ranges::less{}, abs, abs));
+		CHECK(ranges::lexicographical_compare(a, b, ranges::greater{}));
+	}
+
+	// Constant evaluation
+	{
+		constexpr int a[] = {3, 1, 4, 1, 5};
+		constexpr int b[] = {3, 1, 4, 2, 5};
+		static_assert(ranges::equal(a, a));
+		static_assert(!ranges::equal(a, b));
+		static_assert(ranges::mismatch(a, b).in1 == a + 3);
+	}
+
+	return ::test_result();
+}
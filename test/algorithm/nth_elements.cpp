@@ -0,0 +1,147 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/nth_elements.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	template<class T>
+	bool is_selected(const std::vector<T>& v, std::ptrdiff_t nth) {
+		const auto& x = v[nth];
+		return std::all_of(v.begin(), v.begin() + nth, [&](const T& y) { return !(x < y); }) &&
+			std::all_of(v.begin() + nth + 1, v.end(), [&](const T& y) { return !(y < x); });
+	}
+
+	std::vector<int> make_input(int pattern, int n) {
+		std::vector<int> v(n);
+		for (int i = 0; i < n; ++i) {
+			switch (pattern) {
+			case 0: v[i] = static_cast<int>(gen() % (n + 1)); break; // random
+			case 1: v[i] = i; break;                                 // sorted
+			case 2: v[i] = n - i; break;                             // reversed
+			case 3: v[i] = i < n / 2 ? i : n - i; break;             // organ pipe
+			case 4: v[i] = i % 17; break;                            // sawtooth
+			case 5: v[i] = 42; break;                                // all equal
+			default: v[i] = static_cast<int>(gen() % 4); break;      // few distinct
+			}
+		}
+		return v;
+	}
+
+	void test_nth_element(int n) {
+		for (int pattern = 0; pattern < 7; ++pattern) {
+			for (auto nth : {0, 1, n / 100, n / 2, n - n / 100 - 1, n - 2, n - 1}) {
+				auto v = make_input(pattern, n);
+				auto sorted = v;
+				std::sort(sorted.begin(), sorted.end());
+				CHECK(ranges::nth_element(v, v.begin() + nth) == v.end());
+				CHECK(v[nth] == sorted[nth]);
+				CHECK(is_selected(v, nth));
+			}
+		}
+	}
+
+	void test_nth_elements(int n) {
+		const std::vector<std::ptrdiff_t> positions = {
+			n / 2, n * 9 / 10, n * 99 / 100, n * 999 / 1000, 0, n / 2, n - 1};
+		for (int pattern = 0; pattern < 7; ++pattern) {
+			auto v = make_input(pattern, n);
+			auto sorted = v;
+			std::sort(sorted.begin(), sorted.end());
+			CHECK(ranges::ext::nth_elements(v, positions) == v.end());
+			for (auto p : positions) {
+				CHECK(v[p] == sorted[p]);
+				CHECK(is_selected(v, p));
+			}
+
+			CHECK(ranges::ext::nth_elements(v.begin(), v.end(), {n / 4, n / 3},
+				ranges::greater{}) == v.end());
+			std::sort(sorted.begin(), sorted.end(), std::greater<>{});
+			CHECK(v[n / 4] == sorted[n / 4]);
+			CHECK(v[n / 3] == sorted[n / 3]);
+		}
+	}
+
+	// McIlroy's adversary, "A Killer Adversary for Quicksort": values are
+	// decided only as comparisons demand them, so as to make every pivot
+	// as bad as possible.
+	struct adversary {
+		std::vector<int> value;
+		int gas;
+		int solid = 0;
+		int candidate = 0;
+		long comparisons = 0;
+
+		explicit adversary(int n) : value(n, n), gas{n} {}
+
+		bool less(int x, int y) {
+			++comparisons;
+			if (value[x] == gas && value[y] == gas) {
+				value[x == candidate ? x : y] = solid++;
+			}
+			if (value[x] == gas) {
+				candidate = x;
+			} else if (value[y] == gas) {
+				candidate = y;
+			}
+			return value[x] < value[y];
+		}
+	};
+
+	void test_adversary(int n) {
+		for (auto nth : {n / 2, n / 10}) {
+			adversary a{n};
+			std::vector<int> v(n);
+			for (int i = 0; i < n; ++i) v[i] = i;
+			ranges::nth_element(v, v.begin() + nth,
+				[&a](int x, int y) { return a.less(x, y); });
+			// Linear, rather than the quadratic behavior of quickselect.
+			CHECK(a.comparisons < 40L * n);
+			std::vector<int> values(n);
+			for (int i = 0; i < n; ++i) values[i] = a.value[v[i]];
+			CHECK(is_selected(values, nth));
+		}
+	}
+}
+
+int main() {
+	for (int n : {20, 100, 1000, 5000, 100000}) {
+		test_nth_element(n);
+		test_nth_elements(n);
+	}
+	test_adversary(100000);
+
+	// Non-arithmetic elements and projections
+	{
+		std::vector<std::string> v;
+		for (int i = 0; i < 2000; ++i) v.push_back(std::to_string((i * 7919) % 2000));
+		ranges::ext::nth_elements(v, {100, 1000, 1900}, ranges::less{},
+			[](const std::string& s) { return std::stoi(s); });
+		CHECK(v[100] == "100");
+		CHECK(v[1000] == "1000");
+		CHECK(v[1900] == "1900");
+	}
+
+	// No positions
+	{
+		std::vector<int> v = {3, 1, 2};
+		CHECK(ranges::ext::nth_elements(v, std::vector<int>{}) == v.end());
+		CHECK(v == std::vector<int>{3, 1, 2});
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,144 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/execution.hpp>
+#include <stl2/detail/algorithm/inplace_merge.hpp>
+#include <stl2/detail/algorithm/merge.hpp>
+#include <stl2/detail/algorithm/set_difference.hpp>
+#include <stl2/detail/algorithm/set_intersection.hpp>
+#include <stl2/detail/algorithm/set_symmetric_difference.hpp>
+#include <stl2/detail/algorithm/set_union.hpp>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	// Elements are ordered by key; tag tells equivalent elements apart.
+	struct E {
+		int key;
+		int tag;
+		bool operator==(const E& that) const {
+			return key == that.key && tag == that.tag;
+		}
+		bool operator!=(const E& that) const {
+			return !(*this == that);
+		}
+	};
+
+	// A sorted range of n elements, drawn from keys [0, range).
+	std::vector<E> sorted_input(int n, int range, int tag) {
+		std::vector<E> v(n);
+		for (auto& e : v) e = {static_cast<int>(gen() % range), tag++};
+		std::stable_sort(v.begin(), v.end(),
+			[](const E& a, const E& b) { return a.key < b.key; });
+		return v;
+	}
+
+	// The results of each algorithm match those of its sequential namesake.
+	void test(int n1, int n2, int range) {
+		using ranges::ext::par;
+		const auto a = sorted_input(n1, range, 0);
+		const auto b = sorted_input(n2, range, n1);
+		const auto n = a.size() + b.size();
+
+		{
+			std::vector<E> expected(n), out(n);
+			ranges::merge(a, b, expected.begin(), ranges::less{}, &E::key, &E::key);
+			auto r = ranges::merge(par, a, b, out.begin(), ranges::less{}, &E::key, &E::key);
+			CHECK(r.in1 == a.end());
+			CHECK(r.in2 == b.end());
+			CHECK(r.out == out.end());
+			CHECK(out == expected);
+		}
+
+		{
+			std::vector<E> v = a, expected;
+			v.insert(v.end(), b.begin(), b.end());
+			expected = v;
+			std::inplace_merge(expected.begin(), expected.begin() + n1, expected.end(),
+				[](const E& x, const E& y) { return x.key < y.key; });
+			CHECK(ranges::inplace_merge(par, v, v.begin() + n1, ranges::less{}, &E::key) ==
+				v.end());
+			CHECK(v == expected);
+		}
+
+		auto check = [&](const auto& op) {
+			std::vector<E> expected(n), out(n);
+			auto e = op(ranges::ext::seq, a, b, expected.begin(),
+				ranges::less{}, &E::key, &E::key).out;
+			expected.erase(e, expected.end());
+			auto r = op(par, a.begin(), a.end(), b.begin(), b.end(), out.begin(),
+				ranges::less{}, &E::key, &E::key);
+			CHECK(r.in1 == a.end());
+			CHECK((r.out - out.begin()) == (e - expected.begin()));
+			out.erase(r.out, out.end());
+			CHECK(out == expected);
+		};
+		check(ranges::set_union);
+		check(ranges::set_intersection);
+		check(ranges::set_symmetric_difference);
+		{
+			std::vector<E> expected(n), out(n);
+			auto e = ranges::set_difference(a, b, expected.begin(),
+				ranges::less{}, &E::key, &E::key).out;
+			auto r = ranges::set_difference(par, a, b, out.begin(),
+				ranges::less{}, &E::key, &E::key);
+			CHECK(r.in == a.end());
+			CHECK((r.out - out.begin()) == (e - expected.begin()));
+			CHECK(std::equal(out.begin(), r.out, expected.begin()));
+		}
+	}
+}
+
+int main() {
+	for (int range : {1, 100, 1 << 30}) {
+		for (int n1 : {0, 1000, 100000, 300007}) {
+			for (int n2 : {0, 1, 100000, 200003}) {
+				test(n1, n2, range);
+			}
+		}
+	}
+
+	// Disjoint inputs
+	{
+		std::vector<int> a(100000), b(200000), out(300000);
+		for (int i = 0; i < 100000; ++i) a[i] = i;
+		for (int i = 0; i < 200000; ++i) b[i] = 100000 + i;
+		ranges::merge(ranges::ext::par, b, a, out.begin());
+		CHECK(std::is_sorted(out.begin(), out.end()));
+		CHECK(out.front() == 0);
+		CHECK(out.back() == 299999);
+		CHECK(ranges::set_intersection(ranges::ext::par, a, b, out.begin()).out ==
+			out.begin());
+		CHECK(ranges::set_union(ranges::ext::par, a, b, out.begin()).out == out.end());
+	}
+
+	// Move-only elements
+	{
+		std::vector<std::unique_ptr<int>> v;
+		for (int i = 0; i < 200000; ++i) {
+			v.push_back(std::make_unique<int>(i < 100000 ? 2 * i : 2 * (i - 100000) + 1));
+		}
+		auto deref = [](const std::unique_ptr<int>& p) { return *p; };
+		ranges::inplace_merge(ranges::ext::par, v.begin(), v.begin() + 100000, v.end(),
+			ranges::less{}, deref);
+		for (int i = 0; i < 200000; ++i) {
+			CHECK(*v[i] == i);
+		}
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,151 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/execution.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	std::vector<std::vector<int>> inputs(int n) {
+		std::vector<std::vector<int>> result;
+		std::vector<int> v(n);
+
+		for (auto& x : v) x = static_cast<int>(gen());
+		result.push_back(v);
+		for (auto& x : v) x = static_cast<int>(gen() % 100);
+		result.push_back(v);
+		for (auto& x : v) x = 42;
+		result.push_back(v);
+		for (int i = 0; i < n; ++i) v[i] = i;
+		result.push_back(v);
+		for (int i = 0; i < n; ++i) v[i] = n - i;
+		result.push_back(v);
+		for (int i = 0; i < n; ++i) v[i] = i < n / 2 ? i : n - i;
+		result.push_back(v);
+		return result;
+	}
+
+	struct throws_after {
+		std::atomic<int>* budget;
+		bool operator()(int a, int b) const {
+			if (--*budget == 0) {
+				throw std::runtime_error{"comparison"};
+			}
+			return a < b;
+		}
+	};
+}
+
+int main() {
+	using ranges::ext::par;
+	using ranges::ext::par_unseq;
+	using ranges::ext::seq;
+
+	for (int n : {0, 1, 1000, 100000, 300007}) {
+		for (auto const& input : inputs(n)) {
+			auto expected = input;
+			std::sort(expected.begin(), expected.end());
+
+			auto v = input;
+			CHECK(ranges::sort(par, v) == v.end());
+			CHECK(v == expected);
+
+			v = input;
+			CHECK(ranges::sort(par_unseq, v.begin(), v.end()) == v.end());
+			CHECK(v == expected);
+
+			v = input;
+			CHECK(ranges::sort(seq, v) == v.end());
+			CHECK(v == expected);
+
+			// Not eligible for radix sort
+			v = input;
+			ranges::sort(par, v, [](int a, int b) { return a > b; });
+			CHECK(std::equal(v.begin(), v.end(), expected.rbegin()));
+
+			v = input;
+			CHECK(ranges::stable_sort(par, v) == v.end());
+			CHECK(v == expected);
+		}
+	}
+
+	// stable_sort preserves the order of equivalent elements.
+	{
+		using P = std::pair<int, int>;
+		std::vector<P> v(200003);
+		for (int i = 0; i < (int)v.size(); ++i) {
+			v[i] = {static_cast<int>(gen() % 1000), i};
+		}
+		auto expected = v;
+		std::stable_sort(expected.begin(), expected.end(),
+			[](P const& a, P const& b) { return a.first < b.first; });
+		ranges::stable_sort(par, v, ranges::less{}, &P::first);
+		CHECK(v == expected);
+	}
+
+	// Move-only elements and projections
+	{
+		std::vector<std::unique_ptr<std::string>> v;
+		for (int i = 0; i < 100000; ++i) {
+			v.push_back(std::make_unique<std::string>(std::to_string((i * 7919) % 100000)));
+		}
+		auto deref = [](auto const& p) -> std::string const& { return *p; };
+		ranges::sort(par, v, ranges::less{}, deref);
+		CHECK(std::is_sorted(v.begin(), v.end(),
+			[](auto const& a, auto const& b) { return *a < *b; }));
+
+		std::shuffle(v.begin(), v.end(), gen);
+		ranges::stable_sort(par, v, ranges::greater{}, deref);
+		CHECK(std::is_sorted(v.begin(), v.end(),
+			[](auto const& a, auto const& b) { return *a > *b; }));
+		for (auto const& p : v) {
+			CHECK(p != nullptr);
+		}
+	}
+
+	// Exceptions propagate to the caller.
+	{
+		std::vector<int> v = inputs(200000).front();
+		std::atomic<int> budget{500000};
+		bool caught = false;
+		try {
+			ranges::sort(par, v, throws_after{&budget});
+		} catch (std::runtime_error&) {
+			caught = true;
+		}
+		CHECK(caught);
+
+		// The interrupted sort may leave v nearly sorted, which stable_sort
+		// would finish within the budget.
+		v = inputs(200000).front();
+		budget = 500000;
+		caught = false;
+		try {
+			ranges::stable_sort(par, v, throws_after{&budget});
+		} catch (std::runtime_error&) {
+			caught = true;
+		}
+		CHECK(caught);
+	}
+
+	return ::test_result();
+}
@@ -23,10 +23,13 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/pop_heap.hpp>
+#include <stl2/detail/algorithm/is_heap.hpp>
+#include <stl2/detail/algorithm/make_heap.hpp>
 #include <memory>
 #include <random>
 #include <algorithm>
 #include <functional>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -248,6 +251,63 @@ void test_10(int N)
 	delete [] ib;
 }
 
+void test_pop_heap_n(int N)
+{
+	std::vector<int> v(N);
+	for (int i = 0; i < N; ++i)
+		v[i] = static_cast<int>(gen() % (N / 2));
+	auto sorted = v;
+	std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+	for (int k : {0, 1, 2, 10, N / 2, N - 1, N, N + 10})
+	{
+		auto h = v;
+		std::make_heap(h.begin(), h.end());
+		std::vector<int> out(N + 10, -1);
+		auto const m = std::min(k, N);
+		auto r = stl2::ext::pop_heap_n(h.begin(), h.end(), k, out.begin());
+		CHECK(r.in == h.begin() + (N - m));
+		CHECK(r.out == out.begin() + m);
+		CHECK(std::equal(out.begin(), out.begin() + m, sorted.begin()));
+		CHECK(std::is_heap(h.begin(), r.in));
+		std::sort(h.begin(), r.in, std::greater<int>());
+		CHECK(std::equal(h.begin(), r.in, sorted.begin() + m));
+	}
+
+	// Range, sentinel, comparison and projection: the least first
+	{
+		S* ia = new S [N];
+		for (int i = 0; i < N; ++i)
+			ia[i].i = i;
+		std::shuffle(ia, ia+N, gen);
+		stl2::make_heap(ia, ia+N, std::greater<int>(), &S::i);
+		std::vector<S> out;
+		auto r = stl2::ext::pop_heap_n(stl2::subrange(ia, sentinel<S*>(ia+N)), 100,
+			stl2::back_inserter(out), std::greater<int>(), &S::i);
+		CHECK(r.in == ia+N-100);
+		CHECK(out.size() == 100u);
+		for (int i = 0; i < 100; ++i)
+			CHECK(out[i].i == i);
+		CHECK(stl2::is_heap(ia, r.in, std::greater<int>(), &S::i));
+		delete [] ia;
+	}
+
+	// Move-only elements
+	{
+		std::unique_ptr<int>* ia = new std::unique_ptr<int> [N];
+		for (int i = 0; i < N; ++i)
+			ia[i].reset(new int(i));
+		std::shuffle(ia, ia+N, gen);
+		std::make_heap(ia, ia+N, indirect_less());
+		std::vector<std::unique_ptr<int>> out(10);
+		auto r = stl2::ext::pop_heap_n(ia, ia+N, 10, out.begin(), indirect_less());
+		CHECK(r.in == ia+N-10);
+		for (int i = 0; i < 10; ++i)
+			CHECK(*out[i] == N - 1 - i);
+		CHECK(std::is_heap(ia, ia+N-10, indirect_less()));
+		delete [] ia;
+	}
+}
+
 int main()
 {
 	test_1(1000);
@@ -260,6 +320,7 @@ int main()
 	test_8(1000);
 	test_9(1000);
 	test_10(1000);
+	test_pop_heap_n(1000);
 
 	return test_result();
 }
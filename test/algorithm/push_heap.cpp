@@ -35,6 +35,7 @@
 #include <random>
 #include <algorithm>
 #include <functional>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -119,12 +120,74 @@ void test_move_only(int N)
 	delete [] ia;
 }
 
+void test_push_heap_n(int N)
+{
+	// Batches of every size, into heaps of every size, of elements that
+	// belong at the bottom, the top, or anywhere
+	for (int pattern = 0; pattern < 3; ++pattern)
+	{
+		for (int h : {0, 1, 2, 10, N / 2, N})
+		{
+			for (int k : {0, 1, 2, 5, 100, N, 4 * N})
+			{
+				std::vector<int> v(h + k);
+				for (int i = 0; i < h + k; ++i)
+					v[i] = static_cast<int>(gen() % N);
+				std::make_heap(v.begin(), v.begin() + h);
+				for (int i = h; i < h + k; ++i)
+				{
+					if (pattern == 1) v[i] = -i;
+					if (pattern == 2) v[i] = N + i;
+				}
+				auto const expected = v;
+				CHECK(stl2::ext::push_heap_n(v.begin(), v.begin() + h, v.end()) == v.end());
+				CHECK(std::is_heap(v.begin(), v.end()));
+				CHECK(std::is_permutation(v.begin(), v.end(), expected.begin()));
+			}
+		}
+	}
+
+	// Range, comparison and projection
+	{
+		S* ia = new S [N];
+		int* ib = new int [N];
+		for (int i = 0; i < N; ++i)
+			ia[i].i = i;
+		std::shuffle(ia, ia+N, gen);
+		for (int h = 0; h < N; h = 2 * h + 1)
+		{
+			std::make_heap(ia, ia+h, [](S const& x, S const& y) { return x.i > y.i; });
+			auto r = stl2::subrange(ia, ia+N);
+			CHECK(stl2::ext::push_heap_n(r, ia+h, std::greater<int>(), &S::i) == ia+N);
+			std::transform(ia, ia+N, ib, std::mem_fn(&S::i));
+			CHECK(std::is_heap(ib, ib+N, std::greater<int>()));
+			std::shuffle(ia, ia+N, gen);
+		}
+		delete [] ia;
+		delete [] ib;
+	}
+
+	// Move-only elements
+	{
+		std::unique_ptr<int>* ia = new std::unique_ptr<int> [N];
+		for (int i = 0; i < N; ++i)
+			ia[i].reset(new int(i));
+		std::shuffle(ia, ia+N, gen);
+		std::make_heap(ia, ia+N/3, indirect_less());
+		CHECK(stl2::ext::push_heap_n(ia, ia+N/3, sentinel<std::unique_ptr<int>*>(ia+N),
+			indirect_less()) == ia+N);
+		CHECK(std::is_heap(ia, ia+N, indirect_less()));
+		delete [] ia;
+	}
+}
+
 int main()
 {
 	test(1000);
 	test_comp(1000);
 	test_proj(1000);
 	test_move_only(1000);
+	test_push_heap_n(1000);
 
 	{
 		int const N = 1000;
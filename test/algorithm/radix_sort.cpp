@@ -0,0 +1,161 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/radix_sort.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	template<class T>
+	std::vector<T> random_vector(std::size_t n, T lo, T hi) {
+		std::vector<T> v(n);
+		if constexpr (std::is_floating_point_v<T>) {
+			std::uniform_real_distribution<T> dist{lo, hi};
+			for (auto& x : v) x = dist(gen);
+		} else {
+			std::uniform_int_distribution<T> dist{lo, hi};
+			for (auto& x : v) x = dist(gen);
+		}
+		return v;
+	}
+
+	template<class T>
+	void test_numbers(T lo, T hi) {
+		for (std::size_t n : {0u, 1u, 2u, 31u, 1000u, 5000u}) {
+			auto v = random_vector<T>(n, lo, hi);
+			auto expected = v;
+			std::sort(expected.begin(), expected.end());
+
+			auto w = v;
+			CHECK(ranges::ext::radix_sort(w) == w.end());
+			CHECK(w == expected);
+
+			w = v;
+			CHECK(ranges::ext::stable_radix_sort(w.begin(), w.end()) == w.end());
+			CHECK(w == expected);
+
+			// sort dispatches to radix sort for large inputs
+			w = v;
+			CHECK(ranges::sort(w) == w.end());
+			CHECK(w == expected);
+			w = v;
+			CHECK(ranges::sort(w, ranges::greater{}) == w.end());
+			CHECK(std::equal(w.begin(), w.end(), expected.rbegin()));
+		}
+	}
+
+	struct record {
+		int key;
+		int seq;
+		std::string name;
+	};
+}
+
+int main() {
+	test_numbers<std::uint8_t>(0, 255);
+	test_numbers<std::int16_t>(-1000, 1000);
+	test_numbers<int>(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+	test_numbers<std::uint32_t>(0, 100); // most passes are skipped
+	test_numbers<std::int64_t>(std::numeric_limits<std::int64_t>::min(),
+		std::numeric_limits<std::int64_t>::max());
+	test_numbers<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max());
+	test_numbers<float>(-1e6f, 1e6f);
+	test_numbers<double>(-1.0, 1.0);
+
+	// Special floating-point values
+	{
+		const double inf = std::numeric_limits<double>::infinity();
+		std::vector<double> v{3.0, -0.0, inf, -1.5, 0.0, -inf, 1e-300, -1e-300, 0.0, -0.0};
+		ranges::ext::radix_sort(v);
+		CHECK(std::is_sorted(v.begin(), v.end()));
+		CHECK(v.front() == -inf);
+		CHECK(v.back() == inf);
+	}
+
+	// bool keys
+	{
+		std::vector<int> v{1, 0, 1, 1, 0};
+		ranges::ext::radix_sort(v, [](int i) { return i != 0; });
+		CHECK(std::is_sorted(v.begin(), v.end()));
+	}
+
+	// Stability and projections
+	{
+		std::vector<record> v(3000);
+		for (int i = 0; i < (int)v.size(); ++i) {
+			v[i].key = std::uniform_int_distribution<int>{-20, 20}(gen);
+			v[i].seq = i;
+			v[i].name = std::to_string(i);
+		}
+		ranges::ext::stable_radix_sort(v, &record::key);
+		CHECK(std::is_sorted(v.begin(), v.end(), [](auto const& a, auto const& b) {
+			return a.key < b.key || (a.key == b.key && a.seq < b.seq);
+		}));
+		for (auto const& r : v) {
+			CHECK(r.name == std::to_string(r.seq));
+		}
+	}
+
+	// Byte-string keys
+	{
+		std::vector<std::string> v;
+		std::uniform_int_distribution<int> len{0, 12}, ch{'a', 'e'};
+		for (int i = 0; i < 5000; ++i) {
+			std::string s(len(gen), ' ');
+			for (auto& c : s) c = static_cast<char>(ch(gen));
+			v.push_back(std::move(s));
+		}
+		v.push_back(std::string("\xff\x80", 2));
+		v.push_back(std::string("a\0b", 3));
+		v.push_back(std::string(300, 'a'));
+		v.push_back(std::string(299, 'a'));
+		auto expected = v;
+		std::sort(expected.begin(), expected.end());
+
+		auto w = v;
+		ranges::ext::radix_sort(w);
+		CHECK(w == expected);
+
+		w = v;
+		ranges::sort(w);
+		CHECK(w == expected);
+
+		std::vector<std::pair<std::string_view, int>> p;
+		for (int i = 0; i < (int)v.size(); ++i) {
+			p.emplace_back(v[i], i);
+		}
+		ranges::ext::stable_radix_sort(p, &std::pair<std::string_view, int>::first);
+		CHECK(std::is_sorted(p.begin(), p.end()));
+	}
+
+	// Move-only elements
+	{
+		std::vector<std::unique_ptr<int>> v;
+		for (int i = 0; i < 2000; ++i) {
+			v.push_back(std::make_unique<int>((i * 7919) % 2000));
+		}
+		ranges::ext::radix_sort(v, [](auto const& p) { return *p; });
+		for (int i = 0; i < 2000; ++i) {
+			CHECK(*v[i] == i);
+		}
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,100 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/search_n.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	// Random access ranges, which search_n probes every count elements
+	// of, give the results of std::search_n and of the forward search.
+	template<class T>
+	void test(const std::vector<T>& v, const int count, const T value) {
+		const auto expected = std::search_n(v.begin(), v.end(), count, value) - v.begin();
+
+		CHECK((ranges::search_n(v, count, value) - v.begin()) == expected);
+		using R = random_access_iterator<const T*>;
+		CHECK((ranges::search_n(R{v.data()}, R{v.data() + v.size()}, count, value).base() -
+			v.data()) == expected);
+		using F = forward_iterator<const T*>;
+		CHECK((ranges::search_n(F{v.data()}, F{v.data() + v.size()}, count, value).base() -
+			v.data()) == expected);
+		CHECK((ranges::search_n(v, count, value, ranges::equal_to{},
+			[](T x) { return x; }) - v.begin()) == expected);
+	}
+
+	// Runs of random lengths of a few values
+	template<class T>
+	void test_runs(int alphabet) {
+		for (int n : {0, 1, 5, 64, 100, 1000}) {
+			for (int i = 0; i < 10; ++i) {
+				std::vector<T> v;
+				while (static_cast<int>(v.size()) < n) {
+					const auto x = static_cast<T>(gen() % alphabet);
+					v.insert(v.end(), std::min<int>(1 + gen() % 80, n - v.size()), x);
+				}
+				for (int count : {0, 1, 2, 3, 7, 16, 33, 64, 79, 100, 2000}) {
+					test(v, count, T(0));
+					test(v, count, T(1));
+				}
+			}
+		}
+	}
+}
+
+int main() {
+	test_runs<char>(2);
+	test_runs<unsigned char>(3);
+	test_runs<std::int16_t>(2);
+	test_runs<int>(2);
+	test_runs<int>(5);
+	test_runs<std::uint64_t>(2);
+	test_runs<float>(2);
+	test_runs<double>(3);
+
+	// A run at each end, and one a single element short
+	{
+		std::vector<int> v(1000, 7);
+		for (int i = 0; i < 1000; i += 100) v[i] = 0;
+		test(v, 99, 7);
+		test(v, 100, 7);
+		v[0] = 7;
+		test(v, 100, 7);
+		v[900] = 7;
+		test(v, 100, 7);
+		test(v, 1000, 7);
+	}
+
+	// Values the elements can't hold
+	{
+		std::vector<unsigned char> v(100, 255);
+		CHECK(ranges::search_n(v, 10, -1) == v.end());
+		CHECK(ranges::search_n(v, 10, 255) == v.begin());
+		std::vector<signed char> w(100, -1);
+		CHECK(ranges::search_n(w, 10, 255) == w.end());
+	}
+
+	// Constant evaluation
+	{
+		constexpr int a[] = {1, 2, 2, 3, 3, 3, 2, 2, 2, 2};
+		static_assert(ranges::search_n(a, 3, 2) == a + 6);
+		static_assert(ranges::search_n(a, 3, 3) == a + 3);
+		static_assert(ranges::search_n(a, 5, 2) == a + 10);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,180 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/searcher.hpp>
+#include <stl2/detail/algorithm/find_end.hpp>
+#include <stl2/detail/algorithm/search.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	template<class T>
+	std::vector<T> random_input(int n, int alphabet) {
+		std::vector<T> v(n);
+		for (auto& x : v) x = static_cast<T>(gen() % alphabet);
+		return v;
+	}
+
+	// The first and last occurrences of the pattern, found by the
+	// searcher through each kind of iterator, are those std::search and
+	// std::find_end find.
+	template<class T>
+	void test(const std::vector<T>& text, const std::vector<T>& pattern) {
+		const auto expected = std::search(text.begin(), text.end(),
+			pattern.begin(), pattern.end()) - text.begin();
+		const auto expected_last = std::find_end(text.begin(), text.end(),
+			pattern.begin(), pattern.end()) - text.begin();
+		const auto found = std::min<std::ptrdiff_t>(expected, text.size());
+		const auto found_end = expected == static_cast<std::ptrdiff_t>(text.size())
+			? expected : expected + static_cast<std::ptrdiff_t>(pattern.size());
+
+		const ranges::ext::searcher s{pattern};
+		auto r = s(text);
+		CHECK((r.begin() - text.begin()) == found);
+		CHECK((r.end() - text.begin()) == found_end);
+
+		using F = forward_iterator<const T*>;
+		auto r2 = s(F{text.data()}, F{text.data() + text.size()});
+		CHECK((r2.begin().base() - text.data()) == found);
+		CHECK((r2.end().base() - text.data()) == found_end);
+
+		auto r3 = ranges::search(text, pattern);
+		CHECK((r3.begin() - text.begin()) == found);
+		CHECK((r3.end() - text.begin()) == found_end);
+
+		CHECK((ranges::find_end(text, pattern) - text.begin()) == expected_last);
+		std::list<T> l(text.begin(), text.end());
+		CHECK(ranges::distance(l.begin(), ranges::find_end(l, pattern)) == expected_last);
+		CHECK((ranges::find_end(F{text.data()}, F{text.data() + text.size()},
+			pattern.begin(), pattern.end()).base() - text.data()) == expected_last);
+	}
+
+	template<class T>
+	void test_random(int alphabet) {
+		for (int m : {1, 2, 3, 4, 5, 8, 13, 40}) {
+			for (int n : {0, 10, 70, 300}) {
+				for (int i = 0; i < 20; ++i) {
+					const auto text = random_input<T>(n, alphabet);
+					test(text, random_input<T>(m, alphabet));
+					// Patterns that occur in the text
+					if (m <= n) {
+						const auto at = static_cast<int>(gen() % (n - m + 1));
+						test(text, std::vector<T>(text.begin() + at, text.begin() + at + m));
+					}
+				}
+			}
+		}
+	}
+
+	// Texts and patterns of few repeated periods, the hard cases for the
+	// naive search and the periodic case for Two-Way
+	template<class T>
+	void test_periodic() {
+		for (int period = 1; period < 5; ++period) {
+			for (int m = 3; m < 30; m += 3) {
+				std::vector<T> pattern(m);
+				for (int i = 0; i < m; ++i) pattern[i] = static_cast<T>(i % period);
+				std::vector<T> text(200);
+				for (int i = 0; i < 200; ++i) text[i] = static_cast<T>(i % period);
+				test(text, pattern);
+				pattern[m / 2] = static_cast<T>(period);
+				test(text, pattern);
+				text[150] = static_cast<T>(period);
+				test(text, pattern);
+				pattern.back() = static_cast<T>(period + 1);
+				test(text, pattern);
+			}
+		}
+	}
+}
+
+int main() {
+	test_random<char>(2);
+	test_random<char>(4);
+	test_random<unsigned char>(256);
+	test_random<int>(2);
+	test_random<int>(3);
+	test_random<double>(3);
+	test_random<std::byte>(2);
+	test_periodic<char>();
+	test_periodic<signed char>();
+	test_periodic<long>();
+
+	// Bytes not in the pattern, and those the shift table maps to the same
+	// index as those in it
+	{
+		std::vector<signed char> text(100, -1), pattern{-1, 1, -1};
+		text[70] = 1;
+		test(text, pattern);
+		std::vector<int> itext(100, 256 + 'a');
+		itext[50] = 'a';
+		itext[51] = 'b';
+		itext[52] = 'c';
+		const std::string p = "abc";
+		CHECK((ranges::search(itext, p).begin() - itext.begin()) == 50);
+	}
+
+	// A long pattern that almost matches everywhere takes linear time.
+	{
+		std::string text(1 << 22, 'a');
+		std::string pattern(1000, 'a');
+		pattern[0] = 'b';
+		CHECK(ranges::search(text, pattern).empty());
+		CHECK(ranges::find_end(text, pattern) == text.end());
+		pattern[0] = 'a';
+		pattern.back() = 'b';
+		CHECK(ranges::search(text, pattern).empty());
+		text.back() = 'b';
+		CHECK((ranges::search(text, pattern).begin() - text.begin()) ==
+			static_cast<std::ptrdiff_t>(text.size() - pattern.size()));
+		std::vector<int> itext(text.begin(), text.end()), ipattern(pattern.begin(), pattern.end());
+		CHECK((ranges::search(itext, ipattern).begin() - itext.begin()) ==
+			static_cast<std::ptrdiff_t>(text.size() - pattern.size()));
+		// ...as does the last of the occurrences that overlap everywhere,
+		// in a text read forward only.
+		using F = forward_iterator<const char*>;
+		const std::string all_a(pattern.size(), 'a');
+		CHECK((ranges::find_end(F{text.data()}, F{text.data() + text.size()},
+			all_a.begin(), all_a.end()).base() - text.data()) ==
+			static_cast<std::ptrdiff_t>(text.size() - all_a.size() - 1));
+	}
+
+	// A searcher is reused across texts.
+	{
+		const std::string pattern = "needle";
+		const ranges::ext::searcher s{pattern.begin(), pattern.end()};
+		for (std::string text : {"haystack with a needle", "no match", "needle", "needl"}) {
+			CHECK((s(text).begin() - text.begin()) ==
+				static_cast<std::ptrdiff_t>(std::min(text.find(pattern), text.size())));
+		}
+		CHECK(ranges::ext::searcher<const char*>{}("abc").empty());
+	}
+
+	// Constant evaluation
+	{
+		static constexpr int text[] = {1, 2, 1, 2, 1, 3, 1, 2, 1, 3, 4};
+		static constexpr int pattern[] = {1, 2, 1, 3};
+		constexpr ranges::ext::searcher s{pattern};
+		static_assert(s(text).begin() == text + 2);
+		static_assert(s(text).end() == text + 6);
+		static_assert(ranges::find_end(text, pattern) == text + 6);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,96 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/set_intersection.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace stl2 = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	template<class T>
+	std::vector<T> sorted_input(int n, int range) {
+		std::vector<T> v(n);
+		for (auto& x : v) x = static_cast<T>(gen() % range);
+		std::sort(v.begin(), v.end());
+		return v;
+	}
+
+	// Inputs of skewed sizes, which set_intersection gallops through, give
+	// the results and ends of the step-by-step intersection.
+	template<class T>
+	void test(int n1, int n2, int range) {
+		const auto a = sorted_input<T>(n1, range);
+		const auto b = sorted_input<T>(n2, range);
+		std::vector<T> expected;
+		std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+			std::back_inserter(expected));
+
+		std::vector<T> out(std::min(a.size(), b.size()));
+		auto r = stl2::set_intersection(a, b, out.begin());
+		out.erase(r.out, out.end());
+		CHECK(out == expected);
+
+		// The ends are those the input iterator loop stops at.
+		using I = input_iterator<const T*>;
+		std::vector<T> out2(out.size());
+		auto r2 = stl2::set_intersection(I{a.data()}, I{a.data() + a.size()},
+			I{b.data()}, I{b.data() + b.size()}, out2.begin());
+		CHECK((r.in1 - a.begin()) == (r2.in1.base() - a.data()));
+		CHECK((r.in2 - b.begin()) == (r2.in2.base() - b.data()));
+
+		// Descending
+		std::vector<T> ra(a.rbegin(), a.rend()), rb(b.rbegin(), b.rend());
+		out.assign(expected.size(), T{});
+		CHECK(stl2::set_intersection(ra, rb, out.begin(), std::greater<T>{}).out == out.end());
+		CHECK(std::equal(out.begin(), out.end(), expected.rbegin()));
+
+		// Projections
+		out.assign(expected.size(), T{});
+		CHECK(stl2::set_intersection(a, b, out.begin(), stl2::less{},
+			[](T x) { return x; }, [](T x) { return x; }).out == out.end());
+		CHECK(out == expected);
+	}
+
+	template<class T>
+	void test_all() {
+		for (int range : {4, 1000, 1 << 20}) {
+			for (int n1 : {0, 1, 3, 40, 1000, 100000}) {
+				for (int n2 : {0, 1, 7, 1000, 100000}) {
+					test<T>(n1, n2, range);
+				}
+			}
+		}
+	}
+}
+
+int main() {
+	test_all<int>();
+	test_all<unsigned>();
+	test_all<std::int64_t>();
+	test_all<std::int16_t>();
+
+	// Negative keys, compared as signed
+	{
+		std::vector<int> a{-5, -3, -1, 0, 2}, b(1000);
+		for (int i = 0; i < 1000; ++i) b[i] = i - 500;
+		std::vector<int> out(5);
+		CHECK(stl2::set_intersection(a, b, out.begin()).out == out.end());
+		CHECK(out == a);
+	}
+
+	return ::test_result();
+}
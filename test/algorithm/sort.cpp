@@ -163,6 +163,10 @@ test_larger_sorts(int N, int M)
 	std::swap_ranges(array, array+N/2, array+N/2);
 	CHECK(ranges::sort(array, array+N) == array+N);
 	CHECK(std::is_sorted(array, array+N));
+	// test organ pipe pattern
+	std::reverse(array+N/2, array+N);
+	CHECK(ranges::sort(array, array+N) == array+N);
+	CHECK(std::is_sorted(array, array+N));
 	delete [] array;
 }
 
@@ -251,6 +255,7 @@ int main()
 	test_larger_sorts(997);
 	test_larger_sorts(1000);
 	test_larger_sorts(1009);
+	test_larger_sorts(10007);
 
 	// Check move-only types
 	{
@@ -278,6 +283,18 @@ int main()
 		}
 	}
 
+	// Check the branchless partition with floating-point keys
+	{
+		std::vector<double> v(10000);
+		std::uniform_real_distribution<double> dist{-1.0, 1.0};
+		for (auto& d : v)
+			d = dist(gen);
+		CHECK(ranges::sort(v, ranges::greater{}) == v.end());
+		CHECK(std::is_sorted(v.begin(), v.end(), std::greater<double>{}));
+		CHECK(ranges::sort(v) == v.end());
+		CHECK(std::is_sorted(v.begin(), v.end()));
+	}
+
 	// Check rvalue range
 	{
 		std::vector<S> v(1000, S{});
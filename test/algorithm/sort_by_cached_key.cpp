@@ -0,0 +1,89 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/sort_by_cached_key.hpp>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	struct record {
+		std::string field;
+		int id;
+	};
+
+	void test_random(int n) {
+		std::uniform_int_distribution<int> dist{0, n / 4 + 1};
+		std::vector<record> v;
+		for (int i = 0; i < n; ++i) {
+			v.push_back(record{std::to_string(dist(gen)), i});
+		}
+		auto expected = v;
+		auto by_number = [](const record& x, const record& y) {
+			return std::stoi(x.field) < std::stoi(y.field);
+		};
+		std::stable_sort(expected.begin(), expected.end(), by_number);
+
+		int calls = 0;
+		auto proj = [&calls](const record& r) { ++calls; return std::stoi(r.field); };
+		CHECK(ranges::ext::sort_by_cached_key(v, proj) == v.end());
+		CHECK(calls == (n < 2 ? 0 : n));
+		CHECK(std::equal(v.begin(), v.end(), expected.begin(), expected.end(),
+			[](const record& x, const record& y) { return x.id == y.id; }));
+
+		std::stable_sort(expected.begin(), expected.end(),
+			[&](const record& x, const record& y) { return by_number(y, x); });
+		calls = 0;
+		CHECK(ranges::ext::sort_by_cached_key(v.begin(), v.end(), proj,
+			ranges::greater{}) == v.end());
+		CHECK(calls == (n < 2 ? 0 : n));
+		CHECK(std::equal(v.begin(), v.end(), expected.begin(), expected.end(),
+			[](const record& x, const record& y) { return x.id == y.id; }));
+	}
+}
+
+int main() {
+	for (int n : {0, 1, 2, 3, 10, 100, 1000, 10000}) {
+		test_random(n);
+	}
+
+	// Keys that are costly to copy, elements that are move-only
+	{
+		std::vector<std::unique_ptr<int>> v;
+		for (int i = 0; i < 100; ++i) {
+			v.push_back(std::make_unique<int>((i * 37) % 100));
+		}
+		ranges::ext::sort_by_cached_key(v,
+			[](const std::unique_ptr<int>& p) { return std::to_string(*p + 1000); });
+		for (int i = 0; i < 100; ++i) {
+			CHECK(*v[i] == i);
+		}
+	}
+
+	// A permutation made of many cycles
+	{
+		std::vector<int> v(1000);
+		for (int i = 0; i < 1000; ++i) {
+			v[i] = i ^ 1;
+		}
+		ranges::ext::sort_by_cached_key(v, ranges::identity{});
+		CHECK(std::is_sorted(v.begin(), v.end()));
+		CHECK(v.front() == 0);
+		CHECK(v.back() == 999);
+	}
+
+	return ::test_result();
+}
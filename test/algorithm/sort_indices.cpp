@@ -0,0 +1,141 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/sort_indices.hpp>
+#include <stl2/detail/algorithm/apply_permutation.hpp>
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	// A wide element that counts how often it is moved.
+	struct record {
+		static inline int moves = 0;
+
+		int key = 0;
+		int id = 0;
+		std::array<char, 200> payload{};
+
+		record() = default;
+		record(int k, int i) : key{k}, id{i} {}
+		record(record&& that) noexcept
+		: key{that.key}, id{that.id}, payload{that.payload} { ++moves; }
+		record& operator=(record&& that) noexcept {
+			key = that.key;
+			id = that.id;
+			payload = that.payload;
+			++moves;
+			return *this;
+		}
+	};
+
+	std::vector<int> random_keys(int n) {
+		std::uniform_int_distribution<int> dist{0, n / 3 + 1};
+		std::vector<int> v(n);
+		for (auto& x : v) x = dist(gen);
+		return v;
+	}
+
+	void test_sort_indices(int n) {
+		const auto keys = random_keys(n);
+		auto idx = ranges::ext::sort_indices(keys);
+		CHECK(idx.size() == keys.size());
+		CHECK(std::is_sorted(idx.begin(), idx.end(),
+			[&](auto i, auto j) { return keys[i] < keys[j]; }));
+		auto sorted = idx;
+		std::sort(sorted.begin(), sorted.end());
+		for (int i = 0; i < n; ++i) {
+			CHECK(sorted[i] == i);
+		}
+
+		idx = ranges::ext::stable_sort_indices(keys.begin(), keys.end(), ranges::greater{});
+		for (int i = 1; i < n; ++i) {
+			CHECK(keys[idx[i - 1]] >= keys[idx[i]]);
+			if (keys[idx[i - 1]] == keys[idx[i]]) {
+				CHECK(idx[i - 1] < idx[i]);
+			}
+		}
+
+		const int k = n / 3;
+		idx = ranges::ext::partial_sort_indices(keys, k);
+		auto expected = keys;
+		std::sort(expected.begin(), expected.end());
+		for (int i = 0; i < k; ++i) {
+			CHECK(keys[idx[i]] == expected[i]);
+		}
+		sorted = idx;
+		std::sort(sorted.begin(), sorted.end());
+		for (int i = 0; i < n; ++i) {
+			CHECK(sorted[i] == i);
+		}
+	}
+
+	void test_apply_permutation(int n) {
+		const auto keys = random_keys(n);
+		std::vector<record> records;
+		std::vector<std::string> names;
+		for (int i = 0; i < n; ++i) {
+			records.emplace_back(keys[i], i);
+			names.push_back(std::to_string(i));
+		}
+
+		const auto idx = ranges::ext::stable_sort_indices(records, ranges::less{}, &record::key);
+		const auto copy = idx;
+		record::moves = 0;
+		CHECK(ranges::ext::apply_permutation(records, idx) == records.end());
+		// One move per displaced element, plus two per cycle.
+		CHECK(record::moves <= n + n);
+		CHECK(ranges::ext::apply_permutation(names.begin(), names.end(), idx) == names.end());
+		CHECK(idx == copy);
+
+		for (int i = 0; i < n; ++i) {
+			CHECK(records[i].id == idx[i]);
+			CHECK(names[i] == std::to_string(idx[i]));
+			if (i > 0) {
+				CHECK(records[i - 1].key <= records[i].key);
+				if (records[i - 1].key == records[i].key) {
+					CHECK(records[i - 1].id < records[i].id);
+				}
+			}
+		}
+	}
+}
+
+int main() {
+	for (int n : {0, 1, 2, 3, 10, 100, 1000, 10000}) {
+		test_sort_indices(n);
+		test_apply_permutation(n);
+	}
+
+	// The identity moves nothing
+	{
+		std::vector<record> v;
+		for (int i = 0; i < 10; ++i) v.emplace_back(i, i);
+		record::moves = 0;
+		ranges::ext::apply_permutation(v, ranges::ext::sort_indices(v, ranges::less{}, &record::key));
+		CHECK(record::moves == 0);
+	}
+
+	// A single cycle
+	{
+		std::vector<int> v = {0, 1, 2, 3, 4};
+		const std::vector<int> perm = {1, 2, 3, 4, 0};
+		ranges::ext::apply_permutation(v, perm);
+		CHECK(v == std::vector<int>{1, 2, 3, 4, 0});
+	}
+
+	return ::test_result();
+}
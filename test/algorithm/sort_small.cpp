@@ -0,0 +1,140 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/sort_small.hpp>
+#include <stl2/detail/span.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	// By the 0-1 principle a network that sorts every sequence of zeros
+	// and ones sorts everything.
+	template<std::size_t N>
+	bool sorts_all_zero_one() {
+		for (std::uint32_t bits = 0; bits < (std::uint32_t{1} << N); ++bits) {
+			std::array<int, N> a;
+			for (std::size_t i = 0; i < N; ++i) {
+				a[i] = (bits >> i) & 1;
+			}
+			ranges::ext::sort_small(a.begin(), N);
+			if (!std::is_sorted(a.begin(), a.end())) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<std::size_t... Ns>
+	void test_zero_one(std::index_sequence<Ns...>) {
+		CHECK((sorts_all_zero_one<Ns>() && ...));
+	}
+
+	template<class T>
+	void test_random(int n) {
+		std::uniform_int_distribution<int> dist{-50, 50};
+		for (int i = 0; i < 100; ++i) {
+			std::vector<T> v(n);
+			for (auto& x : v) x = static_cast<T>(dist(gen));
+			auto expected = v;
+			std::sort(expected.begin(), expected.end());
+			CHECK(ranges::ext::sort_small(v.begin(), n) == v.end());
+			CHECK(v == expected);
+
+			std::sort(expected.begin(), expected.end(), std::greater<>{});
+			CHECK(ranges::ext::sort_small(v.data(), n, ranges::greater{}) == v.data() + n);
+			CHECK(v == expected);
+		}
+	}
+
+	struct S {
+		int key;
+		int index;
+	};
+}
+
+int main() {
+	test_zero_one(std::make_index_sequence<19>{});
+
+	for (int n = 0; n <= 40; ++n) {
+		test_random<int>(n);
+		test_random<double>(n);
+		test_random<std::uint8_t>(n);
+	}
+
+	// Non-arithmetic elements, with a projection
+	{
+		std::vector<std::string> v;
+		for (int i = 0; i < 30; ++i) {
+			v.push_back(std::to_string((i * 17) % 30));
+		}
+		auto expected = v;
+		std::sort(expected.begin(), expected.end(),
+			[](auto& x, auto& y) { return x.size() != y.size() ? x.size() < y.size() : x < y; });
+		ranges::ext::sort_small(v.begin(), 30, ranges::less{},
+			[](const std::string& s) { return std::stoi(s); });
+		CHECK(v == expected);
+	}
+	{
+		std::vector<S> v(25);
+		for (int i = 0; i < 25; ++i) {
+			v[i] = S{(i * 7) % 25, i};
+		}
+		ranges::ext::sort_small(v.begin(), 25, ranges::greater{}, &S::key);
+		for (int i = 0; i < 25; ++i) {
+			CHECK(v[i].key == 24 - i);
+		}
+	}
+
+	// sort sorts ranges of static extent with a network
+	{
+		std::array<int, 7> a = {5, 3, 6, 0, 1, 4, 2};
+		CHECK(ranges::sort(a) == a.end());
+		CHECK(a == std::array<int, 7>{0, 1, 2, 3, 4, 5, 6});
+	}
+	{
+		int a[5] = {4, 2, 3, 0, 1};
+		CHECK(ranges::sort(a, ranges::greater{}) == a + 5);
+		for (int i = 0; i < 5; ++i) {
+			CHECK(a[i] == 4 - i);
+		}
+	}
+	{
+		std::vector<double> v = {2.5, -1.0, 3.0, 0.5, 1.0, 2.0};
+		ranges::ext::span<double, 4> s{v.data(), 4};
+		CHECK(ranges::sort(s) == s.end());
+		CHECK(v == std::vector<double>{-1.0, 0.5, 2.5, 3.0, 1.0, 2.0});
+	}
+	{
+		std::array<int, 33> a;
+		for (int i = 0; i < 33; ++i) a[i] = (i * 5) % 33;
+		ranges::sort(a);
+		CHECK(std::is_sorted(a.begin(), a.end()));
+	}
+
+	// Usable in constant expressions
+	{
+		constexpr auto a = [] {
+			std::array<int, 6> a = {3, 1, 5, 0, 4, 2};
+			ranges::ext::sort_small(a.begin(), 6);
+			return a;
+		}();
+		static_assert(a[0] == 0 && a[1] == 1 && a[2] == 2 && a[3] == 3 && a[4] == 4 && a[5] == 5);
+	}
+
+	return ::test_result();
+}
@@ -151,6 +151,38 @@ struct S {
 	int i, j;
 };
 
+// Sorts inputs made of natural runs - ascending, strictly descending and
+// with many duplicates - by key, and checks that equal keys keep their order.
+void test_runs(int N) {
+	auto check = [](std::vector<S> v) {
+		ranges::stable_sort(v, std::less<int>{}, &S::i);
+		for (std::size_t k = 1; k < v.size(); ++k) {
+			CHECK(v[k - 1].i <= v[k].i);
+			if (v[k - 1].i == v[k].i) {
+				CHECK(v[k - 1].j < v[k].j);
+			}
+		}
+	};
+	std::vector<S> v(N);
+	// sorted, with a few unsorted records appended
+	for (int i = 0; i < N; ++i) v[i] = S{i / 2, i};
+	for (int i = N - N / 100 - 1; i < N; ++i) v[i].i = gen() % N;
+	check(v);
+	// descending runs with duplicates
+	for (int i = 0; i < N; ++i) v[i] = S{(N - i) / 3, i};
+	check(v);
+	// alternating ascending and descending runs of varying lengths
+	for (int i = 0, len = 1; i < N; len = len * 3 % 101 + 1) {
+		for (int k = 0; k < len && i < N; ++k, ++i) {
+			v[i] = S{len % 2 ? k % 17 : (len - k) % 17, i};
+		}
+	}
+	check(v);
+	// few distinct keys
+	for (int i = 0; i < N; ++i) v[i] = S{int(gen() % 5), i};
+	check(v);
+}
+
 int main() {
 	// test null range
 	int d = 0;
@@ -177,6 +209,10 @@ int main() {
 	test_larger_sorts(1000);
 	test_larger_sorts(1009);
 
+	test_runs(100);
+	test_runs(1000);
+	test_runs(100003);
+
 	// Check move-only types
 	{
 		std::vector<std::unique_ptr<int> > v(1000);
@@ -0,0 +1,140 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// copy and fill of 4K or more also use non-temporal stores.
+#define STL2_NONTEMPORAL_THRESHOLD 4096
+
+#include <stl2/detail/algorithm/stream_copy.hpp>
+#include <stl2/detail/algorithm/stream_fill.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/copy_backward.hpp>
+#include <stl2/detail/algorithm/fill.hpp>
+#include <stl2/detail/algorithm/fill_n.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+#include "../bulk_test.hpp"
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	using bulk_test::bytes;
+	using bulk_test::make;
+
+	// Streaming stores start at the first aligned block of the
+	// destination, and regular stores write the ragged ends: at every
+	// misalignment, the copy and the fill reach each element exactly, and
+	// no further. 5000 elements pass the 4K threshold set above for copy
+	// and fill.
+	template<class T>
+	void test(const int n) {
+		std::vector<T> src(n);
+		for (int i = 0; i < n; ++i) src[i] = make<T>(i);
+		for (int offset = 1; offset < 4; ++offset) {
+			const T guard = make<T>(-1);
+			std::vector<T> dst(n + offset + 1, guard);
+			auto r = ranges::ext::stream_copy(src, dst.data() + offset);
+			CHECK(r.in == src.end());
+			CHECK(r.out == dst.data() + offset + n);
+			CHECK(std::equal(src.begin(), src.end(), dst.begin() + offset));
+			CHECK(dst[offset - 1] == guard);
+			CHECK(dst.back() == guard);
+
+			const T value = make<T>(7);
+			CHECK(ranges::ext::stream_fill(dst.data() + offset, dst.data() + offset + n, value) ==
+				dst.data() + offset + n);
+			CHECK(std::count(dst.begin() + offset, dst.end() - 1, value) == n);
+			CHECK(dst[offset - 1] == guard);
+			CHECK(dst.back() == guard);
+
+			// copy and fill past the threshold
+			std::fill(dst.begin(), dst.end(), guard);
+			ranges::copy(src, dst.begin() + offset);
+			CHECK(std::equal(src.begin(), src.end(), dst.begin() + offset));
+			CHECK(dst.back() == guard);
+			ranges::fill(dst.begin() + offset, dst.end() - 1, value);
+			CHECK(std::count(dst.begin() + offset, dst.end() - 1, value) == n);
+			CHECK(ranges::fill_n(dst.begin() + offset, n, guard) == dst.end() - 1);
+			CHECK(std::count(dst.begin(), dst.end(), guard) == n + offset + 1);
+		}
+	}
+
+	template<class T>
+	void test() {
+		for (int n : bulk_test::sizes) {
+			test<T>(n);
+		}
+		test<T>(5000);
+	}
+}
+
+int main() {
+	test<unsigned char>();
+	test<std::uint16_t>();
+	test<int>();
+	test<double>();
+	test<bytes<3>>();
+	test<bytes<16>>();
+	test<bytes<24>>();
+	test<bytes<128>>();
+
+	// Overlapping ranges are copied as by copy.
+	{
+		std::vector<int> v(10000);
+		for (int i = 0; i < 10000; ++i) v[i] = i;
+		ranges::ext::stream_copy(v.begin() + 100, v.end(), v.begin());
+		CHECK(v[0] == 100);
+		CHECK(v[9899] == 9999);
+		ranges::copy_backward(v.begin(), v.begin() + 9000, v.end());
+		CHECK(v[1000] == 100);
+		CHECK(v[9999] == 9099);
+	}
+
+	// Values converted to the elements' type
+	{
+		std::vector<short> v(10000);
+		ranges::ext::stream_fill(v, 3.7);
+		CHECK(std::count(v.begin(), v.end(), 3) == 10000);
+		std::vector<double> w(10000);
+		ranges::fill(w, 3);
+		CHECK(std::count(w.begin(), w.end(), 3.0) == 10000);
+	}
+
+	// Through reverse_iterators
+	{
+		std::vector<int> src(5000), dst(5000);
+		for (int i = 0; i < 5000; ++i) src[i] = i;
+		ranges::ext::stream_copy(src.rbegin(), src.rend(), dst.rbegin());
+		CHECK(dst == src);
+		ranges::ext::stream_fill(dst.rbegin(), dst.rend(), 9);
+		CHECK(std::count(dst.begin(), dst.end(), 9) == 5000);
+	}
+
+	// Other ranges are copied and filled one element at a time.
+	{
+		std::list<int> l(100, 1);
+		std::vector<int> v(100);
+		auto r = ranges::ext::stream_copy(l, v.begin());
+		CHECK(r.out == v.end());
+		CHECK(std::count(v.begin(), v.end(), 1) == 100);
+		ranges::ext::stream_fill(l, 2);
+		CHECK(std::count(l.begin(), l.end(), 2) == 100);
+		std::vector<std::string> s(10, "a long string that is allocated"), t(10);
+		ranges::ext::stream_copy(s, t.begin());
+		CHECK(t == s);
+		ranges::ext::stream_fill(t, std::string("x"));
+		CHECK(std::count(t.begin(), t.end(), "x") == 10);
+	}
+
+	return ::test_result();
+}
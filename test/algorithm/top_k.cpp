@@ -0,0 +1,84 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/top_k.hpp>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen;
+
+	std::vector<int> make_input(int pattern, int n) {
+		std::vector<int> v(n);
+		for (int i = 0; i < n; ++i) {
+			switch (pattern) {
+			case 0: v[i] = static_cast<int>(gen() % (n + 1)); break;
+			case 1: v[i] = i; break;
+			case 2: v[i] = n - i; break;
+			default: v[i] = i % 7; break;
+			}
+		}
+		return v;
+	}
+
+	void test(int n) {
+		for (int pattern = 0; pattern < 4; ++pattern) {
+			const auto v = make_input(pattern, n);
+			auto sorted = v;
+			std::sort(sorted.begin(), sorted.end());
+			for (int k : {0, 1, 2, 10, n / 2, n, n + 5}) {
+				const auto expected = std::vector<int>(sorted.begin(),
+					sorted.begin() + std::min(k, n));
+				CHECK(ranges::ext::top_k(v, k) == expected);
+				// Through a single-pass range
+				CHECK(ranges::ext::top_k(
+					input_iterator<const int*>{v.data()},
+					sentinel<const int*>{v.data() + n}, k) == expected);
+			}
+			auto greatest = ranges::ext::top_k(v, 3, ranges::greater{});
+			std::sort(sorted.begin(), sorted.end(), std::greater<>{});
+			CHECK(greatest == std::vector<int>(sorted.begin(), sorted.begin() + std::min(3, n)));
+		}
+	}
+
+	struct S {
+		int key;
+		std::unique_ptr<int> payload;
+	};
+}
+
+int main() {
+	for (int n : {0, 1, 5, 100, 10000}) {
+		test(n);
+	}
+
+	// Projections, move-only elements
+	{
+		std::vector<S> v;
+		for (int i = 0; i < 1000; ++i) {
+			v.push_back(S{(i * 389) % 1000, std::make_unique<int>(i)});
+		}
+		auto top = ranges::ext::top_k(ranges::make_move_iterator(v.begin()),
+			ranges::make_move_iterator(v.end()), 5, ranges::greater{}, &S::key);
+		CHECK(top.size() == 5u);
+		for (int i = 0; i < 5; ++i) {
+			CHECK(top[i].key == 999 - i);
+			CHECK(top[i].payload != nullptr);
+		}
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,57 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_TEST_BULK_TEST_HPP
+#define STL2_TEST_BULK_TEST_HPP
+
+// Helpers for the tests of the algorithms that process contiguous ranges
+// a vector or a block of bytes at a time, which check them against the
+// same algorithms over ranges they step through one element at a time.
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace bulk_test {
+	// Sizes about the widths of vectors - 16, 32 and 64 bytes - and of
+	// their multiples, which the kernels split into whole vectors and a
+	// tail.
+	inline constexpr int sizes[] = {0, 1, 3, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65,
+		127, 128, 129, 255, 257, 1000};
+
+	// A trivially copyable object of N bytes, which isn't a number
+	template<int N>
+	struct bytes {
+		unsigned char b[N];
+		bool operator==(const bytes& that) const {
+			return std::equal(b, b + N, that.b);
+		}
+	};
+
+	// The i-th of a sequence of distinct values of T, whose bytes differ
+	template<class T>
+	T make(int i) {
+		if constexpr (std::is_arithmetic_v<T>) {
+			return static_cast<T>(i * 2654435761u);
+		} else {
+			T t;
+			for (auto& x : t.b) x = static_cast<unsigned char>(i++ * 37);
+			return t;
+		}
+	}
+
+	inline std::vector<int> iota(int n, int start = 0) {
+		std::vector<int> v(n);
+		std::iota(v.begin(), v.end(), start);
+		return v;
+	}
+}
+
+#endif
@@ -0,0 +1,153 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/memory/uninitialized_copy.hpp>
+#include <stl2/detail/memory/uninitialized_fill.hpp>
+#include <stl2/detail/memory/uninitialized_move.hpp>
+#include <stl2/detail/memory/uninitialized_value_construct.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../bulk_test.hpp"
+#include "../simple_test.hpp"
+#include "common.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct trivial {
+		int i;
+		char c;
+		double d;
+		bool operator==(const trivial& that) const {
+			return i == that.i && c == that.c && d == that.d;
+		}
+	};
+
+	struct member {
+		int i;
+		int j;
+	};
+
+	// Garbage in each element, which construction replaces
+	template<class T>
+	raw_buffer<T> dirty_buffer(std::ptrdiff_t n) {
+		auto b = make_buffer<T>(n);
+		std::memset(static_cast<void*>(b.data()), 0xa5, n * sizeof(T));
+		return b;
+	}
+
+	// Trivially constructed objects are written in bulk over memory full
+	// of garbage: each algorithm must construct every element, stop at the
+	// end of the shorter range, and return the ends it reached.
+	template<class T>
+	void test(const T& x) {
+		for (int n : bulk_test::sizes) {
+			// Constructs the elements of a dirty buffer of n with f, and
+			// checks they equal y.
+			auto check = [n](auto f, const T& y) {
+				auto b = dirty_buffer<T>(n);
+				CHECK(f(b) == b.end());
+				CHECK(std::count(b.begin(), b.end(), y) == n);
+			};
+			check([&](auto& b) { return ranges::uninitialized_fill(b.begin(), b.end(), x); }, x);
+			check([&](auto& b) { return ranges::uninitialized_fill_n(b.begin(), n, x); }, x);
+			check([](auto& b) { return ranges::uninitialized_value_construct(b); }, T{});
+			check([&](auto& b) { return ranges::uninitialized_value_construct_n(b.begin(), n); }, T{});
+
+			// Copies stop at the end of the shorter range.
+			const std::vector<T> src(n + 1, x);
+			auto b = dirty_buffer<T>(n);
+			auto r = ranges::uninitialized_copy(src, b);
+			CHECK((r.in - src.begin()) == n);
+			CHECK(r.out == b.end());
+			CHECK(std::count(b.begin(), b.end(), x) == n);
+			auto c = dirty_buffer<T>(n + 2);
+			auto rn = ranges::uninitialized_copy_n(src.begin(), n, c.begin(), c.end());
+			CHECK(rn.in == src.begin() + n);
+			CHECK(rn.out == c.begin() + n);
+			CHECK(std::count(c.begin(), rn.out, x) == n);
+			auto m = dirty_buffer<T>(n + 1);
+			auto rm = ranges::uninitialized_move(b, m);
+			CHECK(rm.in == b.end());
+			CHECK(rm.out == m.begin() + n);
+			CHECK(std::count(m.begin(), rm.out, x) == n);
+			auto mn = dirty_buffer<T>(n);
+			auto rmn = ranges::uninitialized_move_n(b.begin(), n, mn.begin(), mn.end());
+			CHECK(rmn.in == b.end());
+			CHECK(std::count(mn.begin(), mn.end(), x) == n);
+		}
+	}
+}
+
+int main() {
+	test<char>('x');
+	test<int>(0x01020304);
+	test<std::uint64_t>(~0ull);
+	test<double>(2.5);
+	test<trivial>({42, 'c', 0.5});
+	test<int*>(nullptr);
+
+	// Value-initialized pointers to members are null, which isn't
+	// all-zero bytes everywhere.
+	{
+		using P = int member::*;
+		auto b = dirty_buffer<P>(100);
+		ranges::uninitialized_value_construct(b);
+		CHECK(std::count(b.begin(), b.end(), nullptr) == 100);
+		ranges::uninitialized_fill(b, &member::j);
+		CHECK(std::count(b.begin(), b.end(), &member::j) == 100);
+	}
+
+	// Values converted to the elements' type
+	{
+		auto b = dirty_buffer<short>(100);
+		ranges::uninitialized_fill(b, 3.7);
+		CHECK(std::count(b.begin(), b.end(), 3) == 100);
+	}
+
+	// Through reverse_iterators and move_iterators
+	{
+		std::vector<int> src(100);
+		for (int i = 0; i < 100; ++i) src[i] = i;
+		auto b = dirty_buffer<int>(100);
+		ranges::uninitialized_copy(src.rbegin(), src.rend(),
+			std::make_reverse_iterator(b.end()), std::make_reverse_iterator(b.begin()));
+		CHECK(std::equal(b.begin(), b.end(), src.begin()));
+		auto c = dirty_buffer<int>(100);
+		ranges::uninitialized_copy(ranges::make_move_iterator(src.begin()),
+			ranges::make_move_iterator(src.end()), c.begin(), c.end());
+		CHECK(std::equal(c.begin(), c.end(), src.begin()));
+	}
+
+	// Objects that aren't trivially constructed are constructed one at a
+	// time.
+	{
+		auto b = make_buffer<std::string>(10);
+		ranges::uninitialized_fill(b, std::string("a long string that is allocated"));
+		CHECK(std::count(b.begin(), b.end(), "a long string that is allocated") == 10);
+		ranges::destroy(b);
+		ranges::uninitialized_value_construct(b);
+		CHECK(std::count(b.begin(), b.end(), "") == 10);
+		const std::vector<std::string> s(10, "another long string that is allocated");
+		ranges::destroy(b);
+		ranges::uninitialized_copy(s, b);
+		CHECK(std::equal(b.begin(), b.end(), s.begin()));
+		auto c = make_buffer<std::string>(10);
+		ranges::uninitialized_move(b, c);
+		CHECK(std::equal(c.begin(), c.end(), s.begin()));
+		CHECK(std::count(b.begin(), b.end(), "") == 10);
+		ranges::destroy(b);
+		ranges::destroy(c);
+	}
+
+	return ::test_result();
+}
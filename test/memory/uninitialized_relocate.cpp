@@ -0,0 +1,143 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/memory/uninitialized_relocate.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+#include "common.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	// Counts its live objects, and throws from the move constructor of
+	// the throw_at-th object moved.
+	struct tracked {
+		static int live;
+		static int moves;
+		static int throw_at;
+
+		int value;
+
+		explicit tracked(int v) : value{v} { ++live; }
+		tracked(const tracked& that) : value{that.value} { ++live; }
+		tracked(tracked&& that) : value{that.value} {
+			if (++moves == throw_at) {
+				throw moves;
+			}
+			that.value = -1;
+			++live;
+		}
+		~tracked() { --live; }
+	};
+	int tracked::live;
+	int tracked::moves;
+	int tracked::throw_at;
+
+	// Owns a heap object, as unique_ptr does: moves of it are trivially
+	// relocatable, though it isn't trivially copyable.
+	struct owner {
+		static int destroyed;
+
+		int* p;
+
+		explicit owner(int v) : p{new int{v}} {}
+		owner(owner&& that) noexcept : p{std::exchange(that.p, nullptr)} {}
+		~owner() {
+			++destroyed;
+			delete p;
+		}
+	};
+	int owner::destroyed;
+}
+
+STL2_OPEN_NAMESPACE {
+	template<>
+	inline constexpr bool ext::enable_trivially_relocatable<owner> = true;
+} STL2_CLOSE_NAMESPACE
+
+int main() {
+	using ranges::ext::uninitialized_relocate;
+	using ranges::ext::uninitialized_relocate_n;
+
+	// Trivially relocatable elements are relocated with memmove.
+	static_assert(ranges::ext::enable_trivially_relocatable<int>);
+	static_assert(ranges::ext::enable_trivially_relocatable<std::pair<int, double>>);
+	static_assert(!ranges::ext::enable_trivially_relocatable<std::string>);
+	for (int n : {0, 1, 17, 1000}) {
+		auto src = make_buffer<int>(n);
+		for (int i = 0; i < n; ++i) src.data()[i] = i;
+		auto dst = make_buffer<int>(n + 1);
+		auto r = uninitialized_relocate(src, dst);
+		CHECK(r.in == src.end());
+		CHECK(r.out == dst.begin() + n);
+		for (int i = 0; i < n; ++i) CHECK(dst.data()[i] == i);
+		auto back = make_buffer<int>(n);
+		auto rn = uninitialized_relocate_n(dst.begin(), n, back.begin(), back.end());
+		CHECK(rn.in == dst.begin() + n);
+		CHECK(rn.out == back.end());
+		for (int i = 0; i < n; ++i) CHECK(back.data()[i] == i);
+	}
+
+	// As are those of types that opt in, whose originals aren't destroyed.
+	{
+		auto src = make_buffer<owner>(10);
+		for (int i = 0; i < 10; ++i) ::new (src.data() + i) owner{i};
+		auto dst = make_buffer<owner>(10);
+		owner::destroyed = 0;
+		uninitialized_relocate(src, dst);
+		CHECK(owner::destroyed == 0);
+		for (int i = 0; i < 10; ++i) CHECK(*dst.data()[i].p == i);
+		ranges::destroy(dst);
+		CHECK(owner::destroyed == 10);
+	}
+
+	// Other elements are moved then destroyed, one at a time, up to the end
+	// of the shorter range.
+	{
+		auto src = make_buffer<std::string>(10);
+		for (int i = 0; i < 10; ++i) {
+			::new (src.data() + i) std::string(40, static_cast<char>('a' + i));
+		}
+		auto dst = make_buffer<std::string>(6);
+		auto r = uninitialized_relocate(src, dst);
+		CHECK(r.in == src.begin() + 6);
+		CHECK(r.out == dst.end());
+		for (int i = 0; i < 6; ++i) CHECK(dst.data()[i] == std::string(40, static_cast<char>('a' + i)));
+		ranges::destroy(dst);
+		ranges::destroy(src.begin() + 6, src.end());
+	}
+
+	// If a move throws, the objects constructed in the output and the rest
+	// of the input are destroyed.
+	{
+		auto src = make_buffer<tracked>(10);
+		tracked::live = 0;
+		for (int i = 0; i < 10; ++i) ::new (src.data() + i) tracked{i};
+		auto dst = make_buffer<tracked>(8);
+		tracked::moves = 0;
+		tracked::throw_at = 5;
+		try {
+			uninitialized_relocate(src, dst);
+			CHECK(false);
+		} catch (int i) {
+			CHECK(i == 5);
+		}
+		// The two elements past the end of the output are left alone.
+		CHECK(tracked::live == 2);
+		CHECK(src.data()[8].value == 8);
+		CHECK(src.data()[9].value == 9);
+		ranges::destroy(src.begin() + 8, src.end());
+		CHECK(tracked::live == 0);
+	}
+
+	return ::test_result();
+}
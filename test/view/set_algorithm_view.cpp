@@ -0,0 +1,174 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/set_algorithm.hpp>
+#include <stl2/detail/algorithm/merge.hpp>
+#include <stl2/detail/algorithm/set_difference.hpp>
+#include <stl2/detail/algorithm/set_intersection.hpp>
+#include <stl2/detail/algorithm/set_symmetric_difference.hpp>
+#include <stl2/detail/algorithm/set_union.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/subrange.hpp>
+#include <stl2/view/take.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace view {
+	using namespace ranges::view;
+	using namespace ranges::view::ext;
+} // namespace view
+
+namespace {
+	std::mt19937 gen;
+
+	// Elements are ordered by key; tag tells equivalent elements apart.
+	struct E {
+		int key;
+		int tag;
+		bool operator==(const E& that) const {
+			return key == that.key && tag == that.tag;
+		}
+		bool operator!=(const E& that) const {
+			return !(*this == that);
+		}
+	};
+
+	std::vector<E> sorted_input(int n, int range, int tag) {
+		std::vector<E> v(n);
+		for (auto& e : v) e = {static_cast<int>(gen() % range), tag++};
+		std::stable_sort(v.begin(), v.end(),
+			[](const E& a, const E& b) { return a.key < b.key; });
+		return v;
+	}
+
+	template<class Rng>
+	std::vector<E> to_vector(Rng&& rng) {
+		std::vector<E> result;
+		for (auto&& e : rng) result.push_back(e);
+		return result;
+	}
+
+	// Each view has the elements its algorithm writes, in the same order.
+	void test(int n1, int n2, int range) {
+		const auto a = sorted_input(n1, range, 0);
+		const auto b = sorted_input(n2, range, n1);
+		auto check = [&](const auto& view, const auto& algorithm) {
+			std::vector<E> expected(a.size() + b.size());
+			expected.erase(algorithm(a, b, expected.begin(), ranges::less{},
+				&E::key, &E::key).out, expected.end());
+			CHECK(to_vector(view(a, b, ranges::less{}, &E::key, &E::key)) == expected);
+			CHECK(to_vector(a | view(b, ranges::less{}, &E::key, &E::key)) == expected);
+		};
+		check(view::merge, ranges::merge);
+		check(view::set_union, ranges::set_union);
+		check(view::set_intersection, ranges::set_intersection);
+		check(view::set_difference, ranges::set_difference);
+		check(view::set_symmetric_difference, ranges::set_symmetric_difference);
+	}
+}
+
+int main() {
+	for (int range : {1, 4, 1000}) {
+		for (int n1 : {0, 1, 10, 100}) {
+			for (int n2 : {0, 1, 10, 100}) {
+				test(n1, n2, range);
+			}
+		}
+	}
+
+	{
+		std::vector<int> a{1, 2, 2, 3, 5, 8}, b{2, 3, 3, 4, 8, 9};
+		CHECK_EQUAL(view::merge(a, b), {1, 2, 2, 2, 3, 3, 3, 4, 5, 8, 8, 9});
+		CHECK_EQUAL(view::set_union(a, b), {1, 2, 2, 3, 3, 4, 5, 8, 9});
+		CHECK_EQUAL(view::set_intersection(a, b), {2, 3, 8});
+		CHECK_EQUAL(view::set_difference(a, b), {1, 2, 5});
+		CHECK_EQUAL(view::set_symmetric_difference(a, b), {1, 2, 3, 4, 5, 9});
+
+		auto rng = a | view::set_intersection(b);
+		static_assert(ranges::View<decltype(rng)>);
+		static_assert(ranges::ForwardRange<decltype(rng)>);
+		static_assert(!ranges::CommonRange<decltype(rng)>);
+		static_assert(ranges::Same<ranges::iter_reference_t<ranges::iterator_t<decltype(rng)>>, int&>);
+	}
+
+	// Nested queries compose, and read only as much as they need.
+	{
+		int comparisons = 0;
+		auto counting_less = [&comparisons](int x, int y) {
+			++comparisons;
+			return x < y;
+		};
+		std::vector<int> evens, multiples_of_3;
+		for (int i = 0; i < 1000000; ++i) {
+			evens.push_back(2 * i);
+			multiples_of_3.push_back(3 * i);
+		}
+		auto rng = evens |
+			view::set_intersection(multiples_of_3, counting_less) |
+			view::set_union(view::iota(1, 4), counting_less) |
+			view::take(6);
+		CHECK_EQUAL(rng, {0, 1, 2, 3, 6, 12});
+		CHECK(comparisons < 100);
+	}
+
+	// begin finds the first element once, however many times it's called.
+	{
+		int comparisons = 0;
+		auto counting_less = [&comparisons](int x, int y) {
+			++comparisons;
+			return x < y;
+		};
+		std::vector<int> a(1000), b(1000);
+		for (int i = 0; i < 1000; ++i) {
+			a[i] = i;
+			b[i] = i + 999;
+		}
+		auto rng = view::set_intersection(a, b, counting_less);
+		CHECK(*rng.begin() == 999);
+		const int first = comparisons;
+		CHECK(first >= 1000);
+		for (int i = 0; i < 10; ++i) {
+			CHECK(!rng.empty());
+			CHECK(rng.front() == 999);
+		}
+		CHECK((comparisons - first) < 100);
+		auto diff = view::set_difference(b, a, counting_less);
+		CHECK(*diff.begin() == 1000);
+		comparisons = 0;
+		CHECK(*diff.begin() == 1000);
+		CHECK(comparisons < 10);
+	}
+
+	// Elements of both ranges with a common reference
+	{
+		std::vector<int> a{1, 3, 5};
+		std::vector<long> b{2, 4};
+		auto rng = view::merge(a, b);
+		static_assert(ranges::Same<ranges::iter_value_t<ranges::iterator_t<decltype(rng)>>, long>);
+		CHECK_EQUAL(rng, {1L, 2L, 3L, 4L, 5L});
+	}
+
+	// Input ranges
+	{
+		int a[] = {1, 4, 6, 9}, b[] = {2, 4, 9, 10};
+		using I = input_iterator<int*>;
+		auto rng = view::set_symmetric_difference(
+			ranges::subrange{I{a}, I{a + 4}}, ranges::subrange{I{b}, I{b + 4}});
+		static_assert(ranges::InputRange<decltype(rng)>);
+		static_assert(!ranges::ForwardRange<decltype(rng)>);
+		CHECK_EQUAL(rng, {1, 2, 6, 10});
+	}
+
+	return ::test_result();
+}